@@ -44,3 +44,14 @@ if ( CPP11_ARRAY )
   add_definitions("-DCPP11_ARRAY")
 endif ( CPP11_ARRAY)
 
+
+try_compile( CPP11_THREAD
+  ${CMAKE_BINARY_DIR}/CMakeTmp
+  ${CMAKE_SOURCE_DIR}/cmake/src/cpp11/thread.cpp
+  COMPILE_DEFINITIONS "-std=c++0x"
+  LINK_LIBRARIES "-pthread"
+  OUTPUT_VARIABLE OUTPUT
+  )
+if ( CPP11_THREAD )
+  add_definitions("-DCPP11_THREAD")
+endif ( CPP11_THREAD)
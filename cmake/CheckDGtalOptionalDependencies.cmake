@@ -117,6 +117,7 @@ SET(C11_AUTO_DGTAL 0)
 SET(C11_FORWARD_DGTAL 0)
 SET(C11_INITIALIZER_DGTAL 0)
 SET(C11_ARRAY 0)
+SET(C11_THREAD_DGTAL 0)
 IF(WITH_C11)
   INCLUDE(CheckCPP11)
   IF (CPP11_INITIALIZER_LIST OR CPP11_AUTO OR CP11_FORWARD_LIST)
@@ -138,6 +139,12 @@ IF(WITH_C11)
       SET(C11_ARRAY 1)
       SET(C11_FEATURES "${C11_FEATURES} std::array")
     ENDIF()
+    IF (CPP11_THREAD)
+      SET(C11_THREAD_DGTAL 1)
+      FIND_PACKAGE(Threads REQUIRED)
+      SET(DGtalLibDependencies ${DGtalLibDependencies} ${CMAKE_THREAD_LIBS_INIT})
+      SET(C11_FEATURES "${C11_FEATURES} std::thread")
+    ENDIF()
     MESSAGE(STATUS "Supported c++11 features: [${C11_FEATURES} ]")
   ELSE()
     MESSAGE(FATAL_ERROR "Your compiler does not support any c++11 feature. Please specify another C++ compiler of disable this WITH_C11 option.")
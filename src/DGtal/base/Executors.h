@@ -0,0 +1,548 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file Executors.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for the executors (serial, OpenMP, thread pool) used
+ * to run sets of independent tasks.
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testExecutors.cpp
+ */
+
+#if defined(Executors_RECURSES)
+#error Recursive header files inclusion detected in Executors.h
+#else // defined(Executors_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define Executors_RECURSES
+
+#if !defined Executors_h
+/** Prevents repeated inclusion of headers. */
+#define Executors_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include <vector>
+#include "DGtal/base/Common.h"
+
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+
+#ifdef CPP11_THREAD
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#endif
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class SerialExecutor
+  /**
+   * Description of class 'SerialExecutor' <p>
+   * \brief Aim: Runs a set of independent tasks sequentially in
+   * the calling thread.
+   *
+   * An executor runs the tasks @f$ 0, \ldots, n-1@f$ of a task
+   * functor @a f, i.e. it evaluates @a f(w, i) for each task index
+   * @a i, where @a w is the index (in [0, nbWorkers()) ) of the
+   * worker running the task. Two tasks running at the same time are
+   * always given different worker indices, so that the task functor
+   * can use per worker buffers without any synchronization.
+   *
+   * Executors share the following interface:
+   * - Size: the type of task and worker indices,
+   * - x.nbWorkers(): an upper bound on the worker indices,
+   * - x.run(n, f): runs the tasks 0..n-1 of @a f and returns when all
+   *   of them are completed.
+   *
+   * Models: SerialExecutor, OpenMPExecutor, ThreadPoolExecutor (if
+   * the C++11 thread support has been detected, CPP11_THREAD).
+   */
+  struct SerialExecutor
+  {
+    /// Type of task and worker indices.
+    typedef std::size_t Size;
+
+    /**
+     * @return the number of workers (1).
+     */
+    Size nbWorkers() const
+    {
+      return 1;
+    }
+
+    /**
+     * Runs the tasks [0, @a nbTasks) of @a aTask in the calling
+     * thread (worker 0), in increasing order.
+     *
+     * @tparam TTask type of task functor (any type such that
+     * aTask(Size, Size) is valid).
+     * @param nbTasks number of tasks.
+     * @param aTask the task functor.
+     */
+    template <typename TTask>
+    void run(const Size nbTasks, TTask & aTask) const
+    {
+      for(Size i = 0; i < nbTasks; ++i)
+        aTask( 0, i );
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const
+    {
+      out << "[SerialExecutor]";
+    }
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return true;
+    }
+  }; // end of class SerialExecutor
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class OpenMPExecutor
+  /**
+   * Description of class 'OpenMPExecutor' <p>
+   * \brief Aim: Runs a set of independent tasks with an OpenMP
+   * parallel loop (dynamic schedule).
+   *
+   * The worker index of a task is the OpenMP thread number. If DGtal
+   * has not been built with OpenMP support (WITH_OPENMP flag), the
+   * tasks are run sequentially as in SerialExecutor.
+   *
+   * @see SerialExecutor for the executor interface.
+   */
+  struct OpenMPExecutor
+  {
+    /// Type of task and worker indices.
+    typedef std::size_t Size;
+
+    /**
+     * @return the maximal number of OpenMP threads.
+     */
+    Size nbWorkers() const
+    {
+#ifdef WITH_OPENMP
+      return (Size) omp_get_max_threads();
+#else
+      return 1;
+#endif
+    }
+
+    /**
+     * Runs the tasks [0, @a nbTasks) of @a aTask in an OpenMP
+     * parallel loop.
+     *
+     * @tparam TTask type of task functor (any type such that
+     * aTask(Size, Size) is valid).
+     * @param nbTasks number of tasks.
+     * @param aTask the task functor.
+     */
+    template <typename TTask>
+    void run(const Size nbTasks, TTask & aTask) const
+    {
+#ifdef WITH_OPENMP
+      //OpenMP 2 loops require a signed index
+      const long n = (long) nbTasks;
+#pragma omp parallel for schedule(dynamic)
+      for(long i = 0; i < n; ++i)
+        aTask( (Size) omp_get_thread_num(), (Size) i );
+#else
+      for(Size i = 0; i < nbTasks; ++i)
+        aTask( 0, i );
+#endif
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const
+    {
+      out << "[OpenMPExecutor] workers=" << nbWorkers();
+    }
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return true;
+    }
+  }; // end of class OpenMPExecutor
+
+
+#ifdef CPP11_THREAD
+  /////////////////////////////////////////////////////////////////////////////
+  // class ThreadPool
+  /**
+   * Description of class 'ThreadPool' <p>
+   * \brief Aim: A process wide pool of std::thread workers running
+   * sets of independent tasks with work stealing.
+   *
+   * There is only one pool per process (see instance()). It is
+   * started at its first use with hardware_concurrency()-1 threads,
+   * the thread calling run() being the last worker. Several threads
+   * may call run() at the same time: the jobs share the pool threads
+   * and the number of running threads never exceeds the number of
+   * cores plus the number of calling threads.
+   *
+   * The tasks of a job are split into one contiguous range per
+   * worker. A worker takes its tasks from the front of its own range
+   * and, when it is empty, steals the second half of the range of
+   * another worker.
+   *
+   * Tasks must not throw exceptions.
+   */
+  class ThreadPool
+  {
+  public:
+    /// Type of task and worker indices.
+    typedef std::size_t Size;
+
+    /// Type of type-erased task functor.
+    typedef std::function<void (Size, Size)> Task;
+
+    /**
+     * @return the process wide thread pool.
+     */
+    static ThreadPool & instance();
+
+    /**
+     * Destructor. Stops and joins the pool threads.
+     */
+    ~ThreadPool();
+
+    /**
+     * @return the number of workers: the pool threads plus the
+     * calling thread.
+     */
+    Size nbWorkers() const
+    {
+      return myThreads.size() + 1;
+    }
+
+    /**
+     * Runs the tasks [0, @a nbTasks) of @a aTask on the pool threads
+     * and on the calling thread (worker nbWorkers()-1). Returns when
+     * all tasks are completed.
+     *
+     * @param nbTasks number of tasks.
+     * @param aTask the task functor.
+     */
+    void run(const Size nbTasks, const Task & aTask);
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private types --------------------------------
+  private:
+
+    /// Range of tasks of one worker.
+    struct Slot
+    {
+      std::mutex mutex;
+      Size begin;
+      Size end;
+    };
+
+    /// A set of tasks submitted by a call to run().
+    struct Job
+    {
+      Job(const Task & aTask, const Size nbTasks, const Size nbSlots);
+
+      Task task;
+      std::vector<Slot> slots;
+      std::atomic<Size> remaining;
+      std::mutex doneMutex;
+      std::condition_variable done;
+    };
+
+    // ------------------------- Private methods ------------------------------
+  private:
+
+    /**
+     * Constructor.
+     * @param nbThreads number of pool threads.
+     */
+    explicit ThreadPool(const Size nbThreads);
+
+    ThreadPool(const ThreadPool & other) = delete;
+    ThreadPool & operator=(const ThreadPool & other) = delete;
+
+    /**
+     * Main loop of the pool thread @a worker.
+     * @param worker the worker index.
+     */
+    void workerLoop(const Size worker);
+
+    /**
+     * Runs tasks of @a job as worker @a worker until no task remains
+     * to be started (neither in its own range nor in another one).
+     * @param job the job.
+     * @param worker the worker index.
+     */
+    static void work(Job & job, const Size worker);
+
+    /**
+     * Removes @a job from the list of active jobs (if present).
+     * @param job the job to remove.
+     */
+    void retire(const std::shared_ptr<Job> & job);
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Pool threads.
+    std::vector<std::thread> myThreads;
+
+    /// Mutex protecting myJobs and myStop.
+    std::mutex myMutex;
+
+    /// Condition to wake up the pool threads.
+    std::condition_variable myWakeUp;
+
+    /// Jobs with tasks to be started.
+    std::vector< std::shared_ptr<Job> > myJobs;
+
+    /// True when the pool threads must stop.
+    bool myStop;
+  }; // end of class ThreadPool
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ThreadPoolExecutor
+  /**
+   * Description of class 'ThreadPoolExecutor' <p>
+   * \brief Aim: Runs a set of independent tasks on the process wide
+   * ThreadPool.
+   *
+   * @see SerialExecutor for the executor interface.
+   */
+  struct ThreadPoolExecutor
+  {
+    /// Type of task and worker indices.
+    typedef std::size_t Size;
+
+    /**
+     * @return the number of workers of the pool.
+     */
+    Size nbWorkers() const
+    {
+      return ThreadPool::instance().nbWorkers();
+    }
+
+    /**
+     * Runs the tasks [0, @a nbTasks) of @a aTask on the thread pool.
+     *
+     * @tparam TTask type of task functor (any type such that
+     * aTask(Size, Size) is valid).
+     * @param nbTasks number of tasks.
+     * @param aTask the task functor.
+     */
+    template <typename TTask>
+    void run(const Size nbTasks, TTask & aTask) const
+    {
+      ThreadPool::instance().run( nbTasks, ThreadPool::Task( std::ref( aTask ) ) );
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const
+    {
+      out << "[ThreadPoolExecutor] ";
+      ThreadPool::instance().selfDisplay( out );
+    }
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+      return ThreadPool::instance().isValid();
+    }
+  }; // end of class ThreadPoolExecutor
+#endif // CPP11_THREAD
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ExecutorMutex
+  /**
+   * Description of class 'ExecutorMutex' <p>
+   * \brief Aim: A mutex protecting data shared by the tasks of the
+   * executors.
+   *
+   * It is a std::mutex if the C++11 thread support has been detected
+   * (CPP11_THREAD), an OpenMP lock if DGtal has been built with OpenMP
+   * support (WITH_OPENMP), and does nothing otherwise (the tasks then
+   * run sequentially).
+   *
+   * A copy is a new unlocked mutex, so that the objects holding one
+   * keep their implicit copy constructor and assignment.
+   */
+  class ExecutorMutex
+  {
+  public:
+
+    /**
+     * Locks a mutex for the lifetime of the object.
+     */
+    class Lock
+    {
+    public:
+      /**
+       * Constructor. Locks @a aMutex.
+       * @param aMutex the mutex.
+       */
+      explicit Lock( ExecutorMutex & aMutex )
+        : myMutex( aMutex )
+      {
+        myMutex.lock();
+      }
+
+      /**
+       * Destructor. Unlocks the mutex.
+       */
+      ~Lock()
+      {
+        myMutex.unlock();
+      }
+
+    private:
+      Lock( const Lock & other );
+      Lock & operator=( const Lock & other );
+
+      /// The locked mutex.
+      ExecutorMutex & myMutex;
+    };
+
+    ExecutorMutex();
+    ExecutorMutex( const ExecutorMutex & other );
+    ~ExecutorMutex();
+
+    /**
+     * Does nothing: the mutex is not copied.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    ExecutorMutex & operator=( const ExecutorMutex & other );
+
+    /// Locks the mutex (waits until it is available).
+    void lock();
+
+    /// Unlocks the mutex.
+    void unlock();
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+#if defined(CPP11_THREAD)
+    std::mutex myMutex;
+#elif defined(WITH_OPENMP)
+    omp_lock_t myMutex;
+#endif
+  }; // end of class ExecutorMutex
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'SerialExecutor'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'SerialExecutor' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const SerialExecutor & object );
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'OpenMPExecutor'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'OpenMPExecutor' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const OpenMPExecutor & object );
+
+#ifdef CPP11_THREAD
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ThreadPoolExecutor'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ThreadPoolExecutor' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const ThreadPoolExecutor & object );
+#endif // CPP11_THREAD
+
+  /**
+   * Default executor: OpenMPExecutor if DGtal has been built with
+   * OpenMP support, SerialExecutor otherwise.
+   */
+#ifdef WITH_OPENMP
+  typedef OpenMPExecutor DefaultExecutor;
+#else
+  typedef SerialExecutor DefaultExecutor;
+#endif
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/base/Executors.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined Executors_h
+
+#undef Executors_RECURSES
+#endif // else defined(Executors_RECURSES)
@@ -0,0 +1,455 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BlockFMM.h
+ *
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * @brief Fast Marching Method by blocks, run in parallel
+ *
+ * This file is part of the DGtal library.
+ *
+ */
+
+#if defined(BlockFMM_RECURSES)
+#error Recursive header files inclusion detected in BlockFMM.h
+#else // defined(BlockFMM_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BlockFMM_RECURSES
+
+#if !defined BlockFMM_h
+/** Prevents repeated inclusion of headers. */
+#define BlockFMM_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <map>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Executors.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BlockFMM
+  /**
+   * Description of template class 'BlockFMM' <p>
+   * \brief Aim: Fast Marching Method (FMM) by blocks,
+   * the blocks being processed in parallel.
+   *
+   * The domain of the image is split into boxes (blocks) of
+   * a given size. Each block has its own distance values and
+   * a one point thick ghost layer holding the values of the
+   * points of the adjacent blocks. The computation is done
+   * in rounds:
+   * - each active block runs a FMM from its initial points
+   *   (the points of the set given at construction that lie
+   *   in the block) and from the values of its ghost layer,
+   * - the active blocks of the next round are the neighbors
+   *   of the blocks whose values on the shared face
+   *   have been created or decreased (in absolute value)
+   *   by more than a tolerance.
+   *
+   * The active blocks of a round are run on an executor
+   * (see Executors.h), each block with its own image,
+   * set and point functor, so that the blocks share
+   * nothing but read-only values. The computation stops
+   * when there is no more active block. The final values
+   * are then written into the image and the set given at
+   * construction.
+   *
+   * The local distances are the ones of FMM (see FMMPointFunctors.h):
+   * they ignore the neighbors whose value is greater than the computed
+   * one, so that the values of the ghost layers can be taken as
+   * accepted values whatever their order. The result is the one of
+   * FMM up to rounding errors (about 1e-12 for L2FirstOrderLocalDistance
+   * and exact for L1LocalDistance and LInfLocalDistance), provided that
+   * the tolerance is zero (default). A positive tolerance saves rounds,
+   * the values then being greater than the ones of FMM by at most
+   * the tolerance times the number of blocks crossed by the propagation.
+   *
+   * Unlike FMM, the propagation cannot be stopped by an area
+   * threshold, but only by a value threshold.
+   *
+   * @tparam TImage  any model of CImage, whose domain is a
+   * HyperRectDomain
+   * @tparam TSet  any model of CDigitalSet
+   * @tparam TPointPredicate  any model of CPointPredicate,
+   * used to bound the computation within a domain
+   * (its operator() is called in parallel)
+   * @tparam TPointFunctor  the local distance, any model of
+   * CPointFunctor taking an image and a set as template parameters,
+   * e.g. L2FirstOrderLocalDistance (default), L1LocalDistance
+   * or LInfLocalDistance
+   * @tparam TExecutor  the executor running the blocks
+   * (default: DefaultExecutor, see Executors.h)
+   *
+   * @see FMM
+   * @see testBlockFMM.cpp
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate,
+	    template <typename, typename> class TPointFunctor = L2FirstOrderLocalDistance,
+	    typename TExecutor = DefaultExecutor >
+  class BlockFMM
+  {
+
+    // ----------------------- Types ------------------------------
+  public:
+
+    //concept assert
+    BOOST_CONCEPT_ASSERT(( CImage<TImage> ));
+    BOOST_CONCEPT_ASSERT(( CDigitalSet<TSet> ));
+    BOOST_CONCEPT_ASSERT(( CPointPredicate<TPointPredicate> ));
+
+    typedef TImage Image;
+    typedef typename Image::Domain Domain;
+    typedef TSet AcceptedPointSet;
+    typedef TPointPredicate PointPredicate;
+    typedef TExecutor Executor;
+
+    //points
+    typedef typename Image::Point Point;
+    typedef typename Image::Value Value;
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename AcceptedPointSet::Point >::value ));
+    BOOST_STATIC_ASSERT(( boost::is_same< Point, typename PointPredicate::Point >::value ));
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain,
+			  HyperRectDomain<typename Domain::Space> >::value ));
+
+    //dimension
+    typedef typename Point::Dimension Dimension;
+
+    //blocks
+    typedef ImageContainerBySTLMap<Domain, Value> BlockImage;
+    typedef DigitalSetFromMap<BlockImage> BlockSet;
+    typedef TPointFunctor<BlockImage, BlockSet> PointFunctor;
+    typedef std::size_t Size;
+
+  private:
+
+    /**
+     * Point predicate of a block: the point predicate
+     * of the computation restricted to the block.
+     */
+    struct BlockPredicate
+    {
+      typedef typename TImage::Point Point;
+      const PointPredicate* predicate;
+      Point lower;
+      Point upper;
+
+      bool operator()(const Point& aPoint) const
+      {
+	return ( lower.isLower( aPoint ) && aPoint.isLower( upper )
+		 && (*predicate)( aPoint ) );
+      }
+    };
+
+    typedef CandidatePointSetByRadixHeap<Domain, Value> BlockCandidatePointSet;
+    typedef FMM<BlockImage, BlockSet, BlockPredicate,
+		PointFunctor, BlockCandidatePointSet> BlockFMMType;
+
+    /// Values of a block
+    typedef std::map<Point, Value> BlockValues;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * Reference on the image
+     */
+    Image& myImage;
+
+    /**
+     * Reference on the set of accepted points
+     */
+    AcceptedPointSet& myAcceptedPoints;
+
+    /**
+     * Constant reference on a point predicate that returns
+     * 'true' inside the domain
+     * where the distance transform is performed
+     */
+    const PointPredicate& myPointPredicate;
+
+    /**
+     * Size of the blocks
+     */
+    Point myBlockSize;
+
+    /**
+     * Value threshold above which the propagation stops
+     */
+    Value myValueThreshold;
+
+    /**
+     * Minimal decrease of a value of a face of a block
+     * that makes the adjacent block active
+     */
+    Value myTolerance;
+
+    /**
+     * Lower bound of the domain of the image
+     */
+    Point myLowerBound;
+
+    /**
+     * Upper bound of the domain of the image
+     */
+    Point myUpperBound;
+
+    /**
+     * Number of blocks along each dimension
+     */
+    Point myNbBlocks;
+
+    /**
+     * Initial points of each block
+     */
+    std::vector<BlockValues> mySeeds;
+
+    /**
+     * Current values of each block
+     */
+    std::vector<BlockValues> myValues;
+
+    /**
+     * Number of rounds of the last computation
+     */
+    Size myNbRounds;
+
+    /**
+     * Number of block computations of the last computation
+     */
+    Size myNbBlockComputations;
+
+    /**
+     * Min value
+     */
+    Value myMinValue;
+
+    /**
+     * Max value
+     */
+    Value myMaxValue;
+
+    /**
+     * Executor running the blocks
+     */
+    Executor myExecutor;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aImg the distance image, whose values at the points
+     * of @a aSet are the initial values
+     * @param aSet the set of points of known distance
+     * (modified by compute())
+     * @param aPointPredicate the point predicate bounding the computation
+     * @param aBlockSize the size of the blocks
+     * @param aValueThreshold value threshold above which the propagation stops
+     * @param aTolerance minimal decrease (in absolute value) of the value
+     * of a point of a face that makes the adjacent block active (0 by default)
+     */
+    BlockFMM(Image& aImg, AcceptedPointSet& aSet,
+	     const PointPredicate& aPointPredicate,
+	     const Point& aBlockSize,
+	     const Value& aValueThreshold = std::numeric_limits<Value>::max(),
+	     const Value& aTolerance = 0);
+
+    /**
+     * Destructor.
+     */
+    ~BlockFMM();
+
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Computation of the signed distance function by marching out
+     * from the initial set of accepted points, block by block,
+     * until no value of the faces of the blocks decreases.
+     * The values are then written into the image and
+     * the points inserted into the set of accepted points.
+     */
+    void compute();
+
+    /**
+     * Minimal distance value in the set of accepted points.
+     *
+     * @return minimal distance value.
+     */
+    Value min() const;
+
+    /**
+     * Maximal distance value in the set of accepted points.
+     *
+     * @return maximal distance value
+     */
+    Value max() const;
+
+    /**
+     * @return the number of blocks.
+     */
+    Size nbBlocks() const;
+
+    /**
+     * @return the number of rounds of the last computation.
+     */
+    Size nbRounds() const;
+
+    /**
+     * @return the number of block computations of the last computation
+     * (at least the number of blocks crossed by the propagation).
+     */
+    Size nbBlockComputations() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aBlock index of a block
+     * @return the domain of the block.
+     */
+    Domain blockDomain(const Size aBlock) const;
+
+    /**
+     * @param aPoint a point of the domain of the image
+     * @return the index of the block containing @a aPoint.
+     */
+    Size blockIndex(const Point& aPoint) const;
+
+    /**
+     * @param aBlock index of a block
+     * @param aFace index of a face (2k for the lower face
+     * along dimension k, 2k+1 for the upper one)
+     * @param aNeighbor (returned) index of the block adjacent
+     * to the face
+     * @return 'true' if there is such a block, 'false' otherwise.
+     */
+    bool neighbor(const Size aBlock, const Dimension aFace, Size& aNeighbor) const;
+
+    /**
+     * Runs a FMM in a block from its initial points and
+     * from the current values of the adjacent blocks.
+     *
+     * @param aBlock index of a block
+     * @param aValues (returned) the values of the block
+     * @param aChanges (returned) for each face, 'true' if a value
+     * has been created or decreased by more than the tolerance
+     */
+    void computeBlock(const Size aBlock, BlockValues& aValues,
+		      char* aChanges) const;
+
+    /**
+     * Task functor running the FMM of the active blocks
+     * (see computeBlock).
+     */
+    struct BlockTask
+    {
+      const BlockFMM * blockFMM;
+      const std::vector<Size> * blocks;
+      std::vector<BlockValues> * values;
+      std::vector<char> * changes;
+
+      void operator()(const std::size_t /*worker*/, const std::size_t i) const
+      {
+	const Size b = (*blocks)[ i ];
+	blockFMM->computeBlock( b, (*values)[ b ],
+				&(*changes)[ 2*Point::dimension*b ] );
+      }
+    };
+    friend struct BlockTask;
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    BlockFMM ( const BlockFMM & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    BlockFMM & operator= ( const BlockFMM & other );
+
+  }; // end of class BlockFMM
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'BlockFMM'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'BlockFMM' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage, typename TSet, typename TPointPredicate,
+	    template <typename, typename> class TPointFunctor, typename TExecutor >
+  std::ostream&
+  operator<< ( std::ostream & out,
+	       const BlockFMM<TImage, TSet, TPointPredicate, TPointFunctor, TExecutor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/BlockFMM.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BlockFMM_h
+
+#undef BlockFMM_RECURSES
+#endif // else defined(BlockFMM_RECURSES)
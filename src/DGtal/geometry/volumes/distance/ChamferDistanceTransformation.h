@@ -0,0 +1,412 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ChamferDistanceTransformation.h
+ * @brief Approximate distance transformation with chamfer masks
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ChamferDistanceTransformation.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testChamferDistanceTransformation.cpp
+ */
+
+#if defined(ChamferDistanceTransformation_RECURSES)
+#error Recursive header files inclusion detected in ChamferDistanceTransformation.h
+#else // defined(ChamferDistanceTransformation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ChamferDistanceTransformation_RECURSES
+
+#if !defined ChamferDistanceTransformation_h
+/** Prevents repeated inclusion of headers. */
+#define ChamferDistanceTransformation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <limits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/Executors.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/ChamferMask.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ChamferDistanceTransformation
+  /**
+   * Description of template class 'ChamferDistanceTransformation' <p>
+   * \brief Aim: Approximate distance transformation with a chamfer
+   * mask (see ChamferMask), by two raster scans of the domain.
+   *
+   * Contrary to DistanceTransformation, no Voronoi site is stored:
+   * the result is the weighted distance to the closest point for
+   * which the predicate is false, one integer per point, written in
+   * a caller-supplied image. Dividing it by the mask normalization
+   * (see distance()) approximates the Euclidean distance. The
+   * computation is in @f$ O(m.n^d)@f$ for a mask of @a m vectors.
+   *
+   * @warning As an image, this class gives the weighted distances:
+   * operator() and constRange() return the integer values of the
+   * image (e.g. 3 for a 4-neighbor with the 3-4 mask), not the
+   * normalized distances returned by distance() (1 in the same
+   * case). This differs from DistanceTransformation, whose
+   * operator() is the Euclidean distance.
+   *
+   * The forward (resp. backward) scan visits the rows (along
+   * dimension 0) in increasing (resp. decreasing) linearized order
+   * and uses the half mask of the vectors pointing to already
+   * visited points. A row first takes the minimum over the vectors
+   * to other rows (independent contiguous loops), then the vectors
+   * along the row are propagated by a sequential loop. In dimension
+   * 3 and more, the rows are grouped by wavefronts of rows that do
+   * not depend on each other, the rows of a wavefront being run by
+   * the executor. In 2D, the scans are sequential.
+   *
+   * Error bounds: the normalized chamfer distance @f$ d_C@f$ of a
+   * vector @a v is compared with its Euclidean length, i.e. the
+   * distance of ExactPredicateLpSeparableMetric<Space,2>. The
+   * maximal relative errors @f$ |d_C(v) - \|v\|| / \|v\|@f$
+   * measured on @f$ 400^2@f$ and @f$ 80^3@f$ domains are 5.7% for
+   * @f$ \langle 3,4 \rangle@f$, 2.0% for @f$ \langle 5,7,11
+   * \rangle@f$, 10.6% for @f$ \langle 3,4,5 \rangle@f$ and 12.5%
+   * for @f$ \langle 7,10,12 \rangle@f$ (mostly overestimations in
+   * 3D). Since the error is relative, the absolute error grows
+   * linearly with the distance.
+   *
+   * @code
+   * typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> Image;
+   * Image image( domain );
+   * ChamferDistanceTransformation<Z3i::DigitalSet, Image>
+   *   dt( set, ChamferMask<Z3i::Space>::mask345(), image );
+   * double d = dt.distance( p );
+   * @endcode
+   *
+   * This class is a model of CConstImage.
+   *
+   * @tparam TPointPredicate point predicate returning true for points
+   * from which we compute the distance (model of CPointPredicate).
+   * @tparam TImageContainer an image with an HyperRectDomain and an
+   * integral value type. The scans step through the rows of the
+   * image by pointer arithmetic, hence the values must be stored in
+   * a contiguous range in the linearized order of the domain: only
+   * ImageContainerBySTLVector is accepted (static assertion).
+   * @tparam TExecutor the executor running the rows of a wavefront
+   * (default: DefaultExecutor, see Executors.h).
+   *
+   * @see DistanceTransformation, ScalarDistanceTransformation
+   */
+  template < typename TPointPredicate,
+             typename TImageContainer,
+             typename TExecutor = DefaultExecutor >
+  class ChamferDistanceTransformation
+  {
+
+  public:
+    BOOST_CONCEPT_ASSERT(( CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( CImage<TImageContainer> ));
+
+    ///Copy of the image types
+    typedef TImageContainer OutputImage;
+    typedef typename OutputImage::Domain Domain;
+    typedef typename Domain::Space Space;
+    typedef typename Space::Point Point;
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Dimension Dimension;
+    typedef typename Space::Size Size;
+
+    //Both Space points and PointPredicate points must be the same.
+    BOOST_STATIC_ASSERT ((boost::is_same< Point,
+                          typename TPointPredicate::Point >::value ));
+
+    //ImageContainer domain type must be  HyperRectangular
+    BOOST_STATIC_ASSERT ((boost::is_same< HyperRectDomain<Space>, Domain >::value ));
+
+    ///Point predicate type
+    typedef TPointPredicate PointPredicate;
+
+    ///Definition of the image value type (weighted distances).
+    typedef typename OutputImage::Value Value;
+
+    ///Integral value type
+    BOOST_STATIC_ASSERT (( std::numeric_limits<Value>::is_integer ));
+
+    ///Contiguous storage of the values (see scanRow)
+    BOOST_STATIC_ASSERT (( boost::is_same< ImageContainerBySTLVector<Domain, Value>,
+                           OutputImage >::value ));
+
+    ///Chamfer mask type
+    typedef ChamferMask<Space, Value> Mask;
+
+    ///Definition of the image constRange.
+    typedef typename OutputImage::ConstRange ConstRange;
+
+    ///Executor type
+    typedef TExecutor Executor;
+
+    ///Self type
+    typedef ChamferDistanceTransformation<TPointPredicate, TImageContainer,
+                                          TExecutor> Self;
+
+    /**
+     * Constructor. Computes the chamfer distance transformation of
+     * the points satisfying the predicate, on the domain of the image
+     * @a anImage.
+     *
+     * @param aPredicate the point predicate (sites are false points).
+     * @param aMask the chamfer mask (copied).
+     * @param anImage the image storing the result (aliased).
+     */
+    ChamferDistanceTransformation(ConstAlias<PointPredicate> aPredicate,
+                                  const Mask & aMask,
+                                  Alias<OutputImage> anImage);
+
+    /**
+     * Default destructor
+     */
+    ~ChamferDistanceTransformation();
+
+    // ------------------- ConstImage model ------------------------
+  public:
+
+    /**
+     * Returns a reference (const) to the computation domain.
+     * @return a domain
+     */
+    const Domain & domain() const
+    {
+      return myImagePtr->domain();
+    }
+
+    /**
+     * Returns a const range on the image values.
+     * @return a const range
+     */
+    ConstRange constRange() const
+    {
+      return myImagePtr->constRange();
+    }
+
+    /**
+     * Access to a weighted distance at a point.
+     *
+     * @warning This is the integer value of the image, i.e. the
+     * chamfer distance times the mask normalization. Use distance()
+     * for the normalized distance.
+     *
+     * @param aPoint the point to probe.
+     * @return the value of the image at @a aPoint.
+     */
+    Value operator()(const Point &aPoint) const
+    {
+      return myImagePtr->operator()(aPoint);
+    }
+
+    /**
+     * Access to the normalized distance at a point.
+     *
+     * @param aPoint the point to probe.
+     * @return the weighted distance at @a aPoint divided by the mask
+     * normalization.
+     */
+    double distance(const Point &aPoint) const
+    {
+      return NumberTraits<Value>::castToDouble( myImagePtr->operator()(aPoint) ) /
+        NumberTraits<Value>::castToDouble( myMask.normalization() );
+    }
+
+    /**
+     * @return the value of points without site (half of the largest
+     * value of the Value type, so that adding a weight never
+     * overflows).
+     */
+    static Value infinity()
+    {
+      return std::numeric_limits<Value>::max() / 2;
+    }
+
+    /**
+     * @return Returns the chamfer mask.
+     */
+    const Mask & mask() const
+    {
+      return myMask;
+    }
+
+    /**
+     * Self Display method.
+     *
+     * @param out output stream
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------- Private functions ------------------------
+  private:
+
+    /// A vector of the half mask to another row: the coordinate
+    /// along the row, the row index shift and the other coordinates.
+    struct RowVector
+    {
+      typename Point::Coordinate shift;
+      std::ptrdiff_t rowShift;
+      Vector vector;
+      Value weight;
+    };
+
+    /**
+     * Computes the distance transformation.
+     */
+    void compute();
+
+    /**
+     * Initializes the values of a row from the predicate.
+     * @param [in] aRow the row index.
+     */
+    void initRow(const std::size_t aRow) const;
+
+    /**
+     * Applies the forward (or backward) half mask to a row.
+     * @param [in] aRow the row index.
+     * @param [in] forward true for the forward scan.
+     */
+    void scanRow(const std::size_t aRow, const bool forward) const;
+
+    /**
+     * Task functor initializing the row of a given index.
+     */
+    struct InitTask
+    {
+      const Self * transformation;
+
+      void operator()(const std::size_t, const std::size_t aRow) const
+      {
+        transformation->initRow( aRow );
+      }
+    };
+    friend struct InitTask;
+
+    /**
+     * Task functor scanning the i-th row of a wavefront.
+     */
+    struct ScanTask
+    {
+      const Self * transformation;
+      const std::size_t * rows;
+      bool forward;
+
+      void operator()(const std::size_t, const std::size_t i) const
+      {
+        transformation->scanRow( rows[ i ], forward );
+      }
+    };
+    friend struct ScanTask;
+
+    // ------------------- Private members ------------------------
+  private:
+
+    ///Pointer to the point predicate
+    const PointPredicate * myPointPredicatePtr;
+
+    ///Pointer to the output image
+    OutputImage * myImagePtr;
+
+    ///Chamfer mask
+    Mask myMask;
+
+    ///Vectors of the forward half mask to other rows
+    std::vector<RowVector> myRowVectors;
+
+    ///Vectors of the forward half mask along the rows (the
+    ///coordinate along the row is negative)
+    std::vector< std::pair<typename Point::Coordinate, Value> > myInRowVectors;
+
+    ///Copy of the domain lower bound
+    Point myLowerBoundCopy;
+
+    ///Copy of the domain upper bound
+    Point myUpperBoundCopy;
+
+    ///Row length
+    std::size_t myRowSize;
+
+    ///Executor running the rows of a wavefront
+    Executor myExecutor;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    ChamferDistanceTransformation ( const ChamferDistanceTransformation & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    ChamferDistanceTransformation & operator= ( const ChamferDistanceTransformation & other );
+
+  }; // end of class ChamferDistanceTransformation
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ChamferDistanceTransformation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ChamferDistanceTransformation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename P, typename TI, typename TE>
+  std::ostream&
+  operator<< ( std::ostream & out, const ChamferDistanceTransformation<P,TI,TE> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/ChamferDistanceTransformation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ChamferDistanceTransformation_h
+
+#undef ChamferDistanceTransformation_RECURSES
+#endif // else defined(ChamferDistanceTransformation_RECURSES)
@@ -0,0 +1,223 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ChamferMask.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ChamferMask.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ChamferMask_RECURSES)
+#error Recursive header files inclusion detected in ChamferMask.h
+#else // defined(ChamferMask_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ChamferMask_RECURSES
+
+#if !defined ChamferMask_h
+/** Prevents repeated inclusion of headers. */
+#define ChamferMask_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CSpace.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ChamferMask
+  /**
+   * Description of template class 'ChamferMask' <p>
+   * \brief Aim: A chamfer mask, i.e. a set of weighted vectors
+   * defining a chamfer (weighted) distance, to be used by
+   * ChamferDistanceTransformation.
+   *
+   * The mask is symmetric: a vector added with addVector() is
+   * added with all its images by the permutations and the sign
+   * changes of the coordinates. The weighted distance divided by the
+   * normalization factor (the weight of the unit vectors for the
+   * usual masks) approximates the Euclidean distance.
+   *
+   * Usual masks are built by the static methods:
+   * - mask34(): @f$ \langle 3,4 \rangle@f$ in 2D,
+   * - mask5711(): @f$ \langle 5,7,11 \rangle@f$ (5x5 mask) in 2D,
+   * - mask345(): @f$ \langle 3,4,5 \rangle@f$ in 3D,
+   * - mask71012(): @f$ \langle 7,10,12 \rangle@f$ in 3D.
+   *
+   * @tparam TSpace the digital space (model of CSpace).
+   * @tparam TWeight the integer type of the weights (default:
+   * DGtal::uint32_t).
+   */
+  template <typename TSpace, typename TWeight = DGtal::uint32_t>
+  class ChamferMask
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    BOOST_CONCEPT_ASSERT(( CSpace<TSpace> ));
+
+    typedef TSpace Space;
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Dimension Dimension;
+    typedef TWeight Weight;
+
+    /// A weighted vector of the mask.
+    typedef std::pair<Vector, Weight> WeightedVector;
+    typedef std::vector<WeightedVector> WeightedVectors;
+    typedef typename WeightedVectors::const_iterator ConstIterator;
+
+    typedef ChamferMask<TSpace, TWeight> Self;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor of an empty mask.
+     * @param aNormalization the normalization factor of the weighted
+     * distances.
+     */
+    ChamferMask( const Weight aNormalization );
+
+    /**
+     * Adds a weighted vector and all its images by the permutations
+     * and the sign changes of the coordinates (if they are not
+     * already in the mask).
+     *
+     * @param aVector a non null vector.
+     * @param aWeight its weight (positive).
+     */
+    void addVector( const Vector & aVector, const Weight aWeight );
+
+    /**
+     * @return the normalization factor of the weighted distances.
+     */
+    Weight normalization() const;
+
+    /**
+     * @return the number of weighted vectors of the mask.
+     */
+    std::size_t size() const;
+
+    /**
+     * @return the largest absolute value of the vector coordinates.
+     */
+    typename Vector::Coordinate radius() const;
+
+    /**
+     * @return an iterator on the first weighted vector.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return an iterator after the last weighted vector.
+     */
+    ConstIterator end() const;
+
+    /**
+     * @return the 2D mask @f$ \langle 3,4 \rangle@f$ (normalization 3).
+     */
+    static Self mask34();
+
+    /**
+     * @return the 2D 5x5 mask @f$ \langle 5,7,11 \rangle@f$
+     * (normalization 5).
+     */
+    static Self mask5711();
+
+    /**
+     * @return the 3D mask @f$ \langle 3,4,5 \rangle@f$ (normalization 3).
+     */
+    static Self mask345();
+
+    /**
+     * @return the 3D mask @f$ \langle 7,10,12 \rangle@f$
+     * (normalization 7).
+     */
+    static Self mask71012();
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private methods ------------------------------
+  private:
+
+    /**
+     * Adds the images of @a aVector by the sign changes of its
+     * coordinates of index at least @a k.
+     */
+    void addSigns( Vector aVector, const Dimension k, const Weight aWeight );
+
+    /**
+     * Adds @a aVector if it is not already in the mask.
+     */
+    void addOne( const Vector & aVector, const Weight aWeight );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The weighted vectors
+    WeightedVectors myVectors;
+
+    /// Normalization factor
+    Weight myNormalization;
+
+  }; // end of class ChamferMask
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ChamferMask'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ChamferMask' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename S, typename W>
+  std::ostream&
+  operator<< ( std::ostream & out, const ChamferMask<S,W> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/ChamferMask.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ChamferMask_h
+
+#undef ChamferMask_RECURSES
+#endif // else defined(ChamferMask_RECURSES)
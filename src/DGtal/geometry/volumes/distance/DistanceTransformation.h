@@ -74,6 +74,14 @@ namespace DGtal
    * Please refer to VoronoiMap documentation for details on the
    * computational cost and parameter description.
    *
+   * After a local modification of the point predicate, the
+   * transformation can be updated with VoronoiMap::update() instead of
+   * being recomputed.
+   *
+   * If only distance values are needed, ScalarDistanceTransformation
+   * stores one scalar per point (instead of a Point) in a
+   * caller-supplied image.
+   *
    * This class is a model of CConstImage.
    *
    * @tparam TSpace type of Digital Space (model of CSpace).
@@ -84,6 +92,8 @@ namespace DGtal
    * VoronoiMap (default: ImageContainerBySTLVector). The space of the
    * image container and the TSpace should match. Furthermore the
    * container value type must be TSpace::Vector.
+   * @tparam TExecutor the executor running the 1D problems of the
+   * underlying VoronoiMap (default: DefaultExecutor).
     *
    * @see distancetransform2D.cpp
    * @see distancetransform3D.cpp
@@ -93,10 +103,12 @@ namespace DGtal
              typename TSeparableMetric,
 	     typename TImageContainer = 
              ImageContainerBySTLVector<HyperRectDomain<TSpace>,
-                                       typename TSpace::Vector>
+                                       typename TSpace::Vector>,
+             typename TExecutor = DefaultExecutor
            >
   class DistanceTransformation: public VoronoiMap<TSpace,TPointPredicate,
-						  TSeparableMetric, TImageContainer>
+						  TSeparableMetric, TImageContainer,
+                                                  TExecutor>
   {
     
   public:
@@ -125,17 +137,18 @@ namespace DGtal
                          typename SeparableMetric::Point>::value));
     
     ///Definition of the image.
-    typedef  DistanceTransformation<TSpace,TPointPredicate,TSeparableMetric> Self;
+    typedef  DistanceTransformation<TSpace,TPointPredicate,TSeparableMetric,
+                                    TImageContainer,TExecutor> Self;
     
-    typedef VoronoiMap<TSpace,TPointPredicate,TSeparableMetric> Parent;
+    typedef VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,
+                       TImageContainer,TExecutor> Parent;
    
     ///Definition of the image constRange
     typedef  DefaultConstImageRange<Self> ConstRange;
 
 
     ///Definition of the image value type.
-    typedef typename VoronoiMap<TSpace,TPointPredicate,
-				TSeparableMetric,TImageContainer>::Domain  Domain;
+    typedef typename Parent::Domain  Domain;
     
     /**
      *  Constructor
@@ -143,10 +156,9 @@ namespace DGtal
      */
     DistanceTransformation(ConstAlias<Domain> aDomain,
                            ConstAlias<PointPredicate> predicate,
-                           ConstAlias<SeparableMetric> aMetric):
-      VoronoiMap<TSpace,TPointPredicate,TSeparableMetric,TImageContainer>(aDomain,
-                                                                          predicate,
-                                                                          aMetric)
+                           ConstAlias<SeparableMetric> aMetric,
+                           const typename Space::Size aBlockSize = 16):
+      Parent(aDomain, predicate, aMetric, aBlockSize)
     {}
     
     /**
@@ -237,11 +249,11 @@ namespace DGtal
 // //                                                                           //
 // ///////////////////////////////////////////////////////////////////////////////
   
-  template <typename S,typename P,typename TSep>
+  template <typename S,typename P,typename TSep, typename TI, typename TE>
   inline
   std::ostream&
   operator<< ( std::ostream & out, 
-               const DistanceTransformation<S,P,TSep> & object )
+               const DistanceTransformation<S,P,TSep,TI,TE> & object )
   {
     object.selfDisplay( out );
     return out;
@@ -47,6 +47,7 @@
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/CSpace.h"
 #include "DGtal/kernel/CInteger.h"
+#include "DGtal/geometry/volumes/distance/SeparableMetricTraits.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -400,6 +401,64 @@ namespace DGtal
                   const Point &endPoint,
                   const typename Point::UnsignedComponent dim) const;
 
+    // ----------------------- Row kernels --------------------------------------
+    /**
+     * Row kernel computing the lower envelope of the sites of a
+     * straight line along some dimension. The sites are given by
+     * packed arrays: @a aX[i] is the abscissa of the i-th site along
+     * the line and @a aH[i] its partial distance to the line (sum of
+     * the squared differences along the other dimensions, as in
+     * hiddenBy with the starting point of the line).
+     *
+     * The sites hidden by their neighbours (see hiddenBy) are removed
+     * in place: the first returned number of entries of @a aX, @a aH
+     * and @a aIndex describe the remaining sites, in the same order.
+     *
+     * @pre the abscissas are strictly increasing.
+     *
+     * @param aX abscissas of the sites (@a n elements).
+     * @param aH partial distances of the sites (@a n elements).
+     * @param aIndex user indices of the sites (@a n elements), moved
+     * along with the sites.
+     * @param n number of sites.
+     *
+     * @return the number of sites of the lower envelope.
+     */
+    std::size_t lowerEnvelope(Abscissa *aX,
+                              Promoted *aH,
+                              std::size_t *aIndex,
+                              const std::size_t n) const;
+
+    /**
+     * Row kernel computing the extent of the cells of the sites of a
+     * lower envelope (see lowerEnvelope) along the line [@a aLower,
+     * @a aUpper]: the cell of the site @a k is [@a aEnds[k-1], @a
+     * aEnds[k]) (with @a aEnds[-1] = @a aLower). The ends are the
+     * closed form of the scan of closest along the line: a point
+     * equidistant to two sites belongs to the cell of the second
+     * one.
+     *
+     * The clamped quotients are computed by
+     * detail::L2CellQuotients, four at a time with AVX2 for int32
+     * abscissas and int64 partial distances. Only this step is
+     * vectorized: their running maximum is a scalar loop, as is the
+     * fill of the row by the caller (see VoronoiRows).
+     *
+     * @param aX abscissas of the sites of the envelope (@a m elements).
+     * @param aH partial distances of the sites (@a m elements).
+     * @param m number of sites (at least one).
+     * @param aLower first abscissa of the line.
+     * @param aUpper last abscissa of the line.
+     * @param aEnds the (non-decreasing) ends of the cells, the last
+     * one being @a aUpper + 1 (@a m elements).
+     */
+    void cellEnds(const Abscissa *aX,
+                  const Promoted *aH,
+                  const std::size_t m,
+                  const Abscissa aLower,
+                  const Abscissa aUpper,
+                  Abscissa *aEnds) const;
+
    // ----------------------- Other services --------------------------------------
     /**
      * Writes/Displays the object on an output stream.
@@ -459,6 +518,51 @@ namespace DGtal
   std::ostream&
   operator<< ( std::ostream & out, const ExactPredicateLpSeparableMetric<T,p,P> & object );
 
+  /**
+   * The @f$ l_2@f$ metric provides the row kernels.
+   */
+  template <typename T, typename P>
+  struct SeparableMetricTraits< ExactPredicateLpSeparableMetric<T,2,P> >
+  {
+    typedef TagTrue HasRowKernels;
+    typedef P RowValue;
+  };
+
+  namespace detail
+  {
+    /**
+     * Quotients of the l_2 cell ends kernel (see
+     * ExactPredicateLpSeparableMetric::cellEnds), with a loop. The
+     * specialization for DGtal::int32_t abscissas and DGtal::int64_t
+     * partial distances (see ExactPredicateLpSeparableMetric.ih)
+     * uses AVX2 instructions when the compiler enables them. The
+     * rest of the row scan is not vectorized.
+     *
+     * @tparam TAbscissa the type of the abscissas.
+     * @tparam TPromoted the type of the partial distances.
+     */
+    template <typename TAbscissa, typename TPromoted>
+    struct L2CellQuotients
+    {
+      /**
+       * Computes, for each k < @a n, the first abscissa closer (or
+       * equidistant) to the site k+1 than to the site k, clamped to
+       * [@a aLower, @a aLast].
+       *
+       * @param aX abscissas of the sites (@a n + 1 elements).
+       * @param aH partial distances of the sites (@a n + 1 elements).
+       * @param n number of quotients.
+       * @param aLower lower bound of the quotients.
+       * @param aLast upper bound of the quotients.
+       * @param aEnds the clamped quotients (@a n elements).
+       */
+      static void compute( const TAbscissa *aX, const TPromoted *aH,
+                           const std::size_t n,
+                           const TPromoted aLower, const TPromoted aLast,
+                           TAbscissa *aEnds );
+    };
+  } // namespace detail
+
 } // namespace DGtal
 
 
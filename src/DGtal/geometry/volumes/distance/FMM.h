@@ -55,48 +55,13 @@
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/kernel/CPointFunctor.h"
 #include "DGtal/geometry/volumes/distance/FMMPointFunctors.h"
+#include "DGtal/geometry/volumes/distance/FMMCandidatePointSets.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
 {
 
-  namespace details
-  {
-  /////////////////////////////////////////////////////////////////////////////
-  // template class PointValueCompare
-  /**
-   * Description of template class 'PointValueCompare' <p>
-   * \brief Aim: Small binary predicate to order candidates points 
-   * according to their (absolute) distance value. 
-   *
-   * @tparam T model of pair Point-Value
-   */
-    template<typename T>
-    class PointValueCompare {
-    public: 
-      /**
-       * Comparison function
-       *
-       * @param a an object of type T
-       * @param b another object of type T
-       *
-       * @return true if a < b but false otherwise
-       */
-      bool operator()(const T& a, const T& b) 
-      {
-	if ( std::abs(a.second) == std::abs(b.second) ) 
-	  { //point comparison
-	    return (a.first < b.first); 
-	  }
-	else //distance comparison
-	  //(in absolute value in order to deal with
-	  //signed distance values) 
-	  return ( std::abs(a.second) < std::abs(b.second) ); 
-      }
-    };
-  }
-
   /////////////////////////////////////////////////////////////////////////////
   // template class FMM
   /**
@@ -122,8 +87,14 @@ namespace DGtal
    * accepted points. The tentative values of the candidates adjacent 
    * to the newly added point are updated using the distance value
    * of the newly added point. The search of the point of smallest
-   * tentative value is accelerated using a STL set of pairs (point, 
-   * tentative value).  
+   * tentative value is accelerated using a container of pairs (point, 
+   * tentative value), which is a STL set by default 
+   * (CandidatePointSetBySTLSet). 
+   * CandidatePointSetByRadixHeap, a radix heap with a dense index of 
+   * the domain of the image, avoids the tree rebalancing, the node 
+   * allocations and the lookups in the set of accepted points, which 
+   * is much faster on large images (the computed values are the same). 
+   * @see FMMCandidatePointSets.h
    *
    * @tparam TImage  any model of CImage
    * @tparam TSet  any model of CDigitalSet
@@ -131,6 +102,9 @@ namespace DGtal
    * used to bound the computation within a domain 
    * @tparam TPointFunctor  any model of CPointFunctor,
    * used to compute the new distance value
+   * @tparam TCandidatePointSet  container of the candidate points, 
+   * either CandidatePointSetBySTLSet (default) or 
+   * CandidatePointSetByRadixHeap
    *
    * You can define the FMM type as follows: 
    @snippet geometry/volumes/distance/exampleFMM3D.cpp FMMDef
@@ -143,7 +117,10 @@ namespace DGtal
    * @see testFMM.cpp
    */
   template <typename TImage, typename TSet, typename TPointPredicate, 
-	    typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet> >
+	    typename TPointFunctor = L2FirstOrderLocalDistance<TImage,TSet>,
+	    typename TCandidatePointSet = 
+	    CandidatePointSetBySTLSet<typename TImage::Domain, 
+				      typename TPointFunctor::Value> >
   class FMM
   {
 
@@ -176,12 +153,15 @@ namespace DGtal
     typedef typename PointFunctor::Value Value; 
 
 
+    //candidates
+    typedef TCandidatePointSet CandidatePointSet; 
+    BOOST_STATIC_ASSERT(( ConceptUtils::SameType< Point, typename CandidatePointSet::Point >::value ));
+    BOOST_STATIC_ASSERT(( ConceptUtils::SameType< Value, typename CandidatePointSet::Value >::value ));
+
   private: 
 
     //intern data types
-    typedef std::pair<Point, Value> PointValue; 
-    typedef std::set<PointValue,
-		     details::PointValueCompare<PointValue> > CandidatePointSet; 
+    typedef typename CandidatePointSet::PointValue PointValue; 
     typedef unsigned long Area;
 
     // ------------------------- Private Datas --------------------------------
@@ -509,9 +489,9 @@ namespace DGtal
    * @param object the object of class 'FMM' to write.
    * @return the output stream after the writing.
    */
-  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor >
+  template <typename TImage, typename TSet, typename TPointPredicate, typename TPointFunctor, typename TCandidatePointSet >
   std::ostream&
-  operator<< ( std::ostream & out, const FMM<TImage, TSet, TPointPredicate, TPointFunctor> & object );
+  operator<< ( std::ostream & out, const FMM<TImage, TSet, TPointPredicate, TPointFunctor, TCandidatePointSet> & object );
 
 } // namespace DGtal
 
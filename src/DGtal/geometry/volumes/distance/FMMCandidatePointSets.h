@@ -0,0 +1,450 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FMMCandidatePointSets.h
+ *
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * @brief Containers of the candidate points of the Fast Marching Method
+ *
+ * This file is part of the DGtal library.
+ *
+ */
+
+#if defined(FMMCandidatePointSets_RECURSES)
+#error Recursive header files inclusion detected in FMMCandidatePointSets.h
+#else // defined(FMMCandidatePointSets_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FMMCandidatePointSets_RECURSES
+
+#if !defined FMMCandidatePointSets_h
+/** Prevents repeated inclusion of headers. */
+#define FMMCandidatePointSets_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace details
+  {
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PointValueCompare
+  /**
+   * Description of template class 'PointValueCompare' <p>
+   * \brief Aim: Small binary predicate to order candidates points
+   * according to their (absolute) distance value.
+   *
+   * @tparam T model of pair Point-Value
+   */
+    template<typename T>
+    class PointValueCompare {
+    public:
+      /**
+       * Comparison function
+       *
+       * @param a an object of type T
+       * @param b another object of type T
+       *
+       * @return true if a < b but false otherwise
+       */
+      bool operator()(const T& a, const T& b) const
+      {
+	if ( std::abs(a.second) == std::abs(b.second) )
+	  { //point comparison
+	    return (a.first < b.first);
+	  }
+	else //distance comparison
+	  //(in absolute value in order to deal with
+	  //signed distance values)
+	  return ( std::abs(a.second) < std::abs(b.second) );
+      }
+    };
+
+    /**
+     * Unsigned integer key of the absolute value of a distance value,
+     * whose order is the order of the absolute values (the bits of a
+     * positive IEEE 754 floating point number are ordered as the
+     * number).
+     *
+     * @param aValue any distance value
+     * @return the key of |aValue|
+     */
+    inline DGtal::uint64_t radixKey(const double& aValue)
+    {
+      const double a = std::abs( aValue );
+      DGtal::uint64_t key;
+      std::memcpy( &key, &a, sizeof(double) );
+      return key;
+    }
+
+    /// @see radixKey(const double&)
+    inline DGtal::uint64_t radixKey(const float& aValue)
+    {
+      const float a = std::abs( aValue );
+      DGtal::uint32_t key;
+      std::memcpy( &key, &a, sizeof(float) );
+      return key;
+    }
+
+    /// @see radixKey(const double&), integer distance values
+    template<typename T>
+    inline DGtal::uint64_t radixKey(const T& aValue)
+    {
+      return static_cast<DGtal::uint64_t>( std::abs( aValue ) );
+    }
+  }
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CandidatePointSetBySTLSet
+  /**
+   * Description of template class 'CandidatePointSetBySTLSet' <p>
+   * \brief Aim: Container of the candidate points of FMM (pairs point,
+   * tentative distance value) based on a STL set ordered by absolute
+   * distance value, then by point.
+   *
+   * A point may be inserted several times (with different values),
+   * FMM ignores the pairs whose point has already been accepted.
+   * The lookups in the set of accepted points are done in this
+   * set (see isAccepted).
+   *
+   * This is the default container of FMM, each insertion or removal
+   * is in O(log n) (and allocates or frees a node).
+   *
+   * @tparam TDomain type of the domain of the distance image
+   * @tparam TValue type of the distance values
+   *
+   * @see FMM CandidatePointSetByRadixHeap
+   */
+  template <typename TDomain, typename TValue>
+  class CandidatePointSetBySTLSet
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef TValue Value;
+    typedef std::pair<Point, Value> PointValue;
+    typedef std::size_t Size;
+
+  private:
+    typedef std::set<PointValue,
+		     details::PointValueCompare<PointValue> > Container;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aDomain the domain of the distance image (not used)
+     */
+    CandidatePointSetBySTLSet(const Domain& aDomain)
+    {
+      boost::ignore_unused_variable_warning( aDomain );
+    }
+
+    /**
+     * Removes all the candidates.
+     */
+    void clear()
+    {
+      myContainer.clear();
+    }
+
+    /**
+     * @return 'true' if there is no candidate, 'false' otherwise.
+     */
+    bool empty() const
+    {
+      return myContainer.empty();
+    }
+
+    /**
+     * @return the number of candidates.
+     */
+    Size size() const
+    {
+      return myContainer.size();
+    }
+
+    /**
+     * @return the candidate of min absolute distance value
+     * (the min point for equal values).
+     * NB: the container must not be empty.
+     */
+    const PointValue& top() const
+    {
+      ASSERT( !empty() );
+      return *myContainer.begin();
+    }
+
+    /**
+     * Removes the candidate returned by top().
+     */
+    void pop()
+    {
+      ASSERT( !empty() );
+      myContainer.erase( myContainer.begin() );
+    }
+
+    /**
+     * Inserts a candidate.
+     * @param aPointValue a pair point, tentative distance value.
+     */
+    void insert(const PointValue& aPointValue)
+    {
+      myContainer.insert( aPointValue );
+    }
+
+    /**
+     * Marks a point as accepted (nothing to do, the set of accepted
+     * points is used).
+     * @param aPoint any point
+     */
+    void accept(const Point& aPoint)
+    {
+      boost::ignore_unused_variable_warning( aPoint );
+    }
+
+    /**
+     * @param aPoint any point
+     * @param aSet the set of accepted points
+     * @return 'true' if @a aPoint belongs to @a aSet, 'false' otherwise.
+     */
+    template <typename TSet>
+    bool isAccepted(const Point& aPoint, const TSet& aSet) const
+    {
+      return ( aSet.find( aPoint ) != aSet.end() );
+    }
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Set of candidate points
+    Container myContainer;
+
+  }; // end of class CandidatePointSetBySTLSet
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class CandidatePointSetByRadixHeap
+  /**
+   * Description of template class 'CandidatePointSetByRadixHeap' <p>
+   * \brief Aim: Container of the candidate points of FMM (pairs point,
+   * tentative distance value) based on a radix heap and on a dense
+   * index of the domain.
+   *
+   * The candidates are stored in buckets according to the highest bit
+   * of their key (see details::radixKey) which differs from the key of
+   * the last removed candidate. Since the FMM tentative values are
+   * (almost always) greater than the last accepted value, each candidate is
+   * moved at most 64 times before being removed and there is neither
+   * tree rebalancing nor node allocation. The candidates of the first
+   * bucket (key lower than or equal to the last removed key) are kept in a
+   * binary heap ordered as in CandidatePointSetBySTLSet, so that the
+   * candidates are removed in the same order and FMM computes the same
+   * distance values.
+   *
+   * The dense index (one flag and one value per point of the domain)
+   * stores the accepted points, which replaces the lookups in the set
+   * of accepted points, and the best tentative value of each point: a
+   * candidate whose value is not better is not inserted.
+   *
+   * @tparam TDomain type of the domain of the distance image
+   * (hyper-rectangular domain)
+   * @tparam TValue type of the distance values (floating-point or
+   * integer numbers)
+   *
+   * @see FMM CandidatePointSetBySTLSet
+   */
+  template <typename TDomain, typename TValue>
+  class CandidatePointSetByRadixHeap
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef TValue Value;
+    typedef std::pair<Point, Value> PointValue;
+    typedef std::size_t Size;
+
+  private:
+    typedef std::vector<PointValue> Bucket;
+    typedef typename Point::Dimension Dimension;
+
+    /**
+     * Reverse order of details::PointValueCompare (the first bucket
+     * is a max-heap for this order).
+     */
+    struct Greater
+    {
+      bool operator()(const PointValue& a, const PointValue& b) const
+      {
+	return details::PointValueCompare<PointValue>()( b, a );
+      }
+    };
+
+    /// Number of buckets
+    static const unsigned int nbBuckets = 65;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aDomain the domain of the distance image
+     * (all the candidate and accepted points must lie in it)
+     */
+    CandidatePointSetByRadixHeap(const Domain& aDomain);
+
+    /**
+     * Removes all the candidates and all the accepted marks.
+     */
+    void clear();
+
+    /**
+     * @return 'true' if there is no candidate, 'false' otherwise.
+     */
+    bool empty() const
+    {
+      return (mySize == 0);
+    }
+
+    /**
+     * @return the number of candidates.
+     */
+    Size size() const
+    {
+      return mySize;
+    }
+
+    /**
+     * @return the candidate of min absolute distance value
+     * (the min point for equal values).
+     * NB: the container must not be empty.
+     */
+    const PointValue& top() const
+    {
+      ASSERT( !empty() );
+      return myBuckets[0].front();
+    }
+
+    /**
+     * Removes the candidate returned by top().
+     */
+    void pop();
+
+    /**
+     * Inserts a candidate if its value is better than the
+     * best value already inserted for its point.
+     * @param aPointValue a pair point, tentative distance value.
+     */
+    void insert(const PointValue& aPointValue);
+
+    /**
+     * Marks a point as accepted.
+     * @param aPoint any point of the domain
+     */
+    void accept(const Point& aPoint)
+    {
+      myAcceptedFlags[ index( aPoint ) ] = true;
+    }
+
+    /**
+     * @param aPoint any point of the domain
+     * @param aSet the set of accepted points (not used)
+     * @return 'true' if @a aPoint has been marked as accepted,
+     * 'false' otherwise.
+     */
+    template <typename TSet>
+    bool isAccepted(const Point& aPoint, const TSet& aSet) const
+    {
+      boost::ignore_unused_variable_warning( aSet );
+      return myAcceptedFlags[ index( aPoint ) ];
+    }
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aPoint any point of the domain
+     * @return the index of @a aPoint in the dense index
+     */
+    Size index(const Point& aPoint) const;
+
+    /**
+     * @param aKey any key
+     * @return the bucket of @a aKey (0 if @a aKey is lower than or
+     * equal to the last removed key, otherwise 1 + the highest bit
+     * which differs).
+     */
+    unsigned int bucket(DGtal::uint64_t aKey) const;
+
+    /**
+     * Moves the candidates of the first non-empty bucket to the lower
+     * buckets, the new last key being their min key.
+     * NB: the first bucket must be empty and the container not empty.
+     */
+    void refill();
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Buckets of candidates (the first one is a heap)
+    std::vector<Bucket> myBuckets;
+    /// Number of candidates
+    Size mySize;
+    /// Last removed key
+    DGtal::uint64_t myLastKey;
+    /// Lower bound of the domain
+    Point myLowerBound;
+    /// Strides of the dense index (dimension 0 first)
+    std::vector<Size> myStrides;
+    /// Accepted marks
+    std::vector<bool> myAcceptedFlags;
+    /// Best inserted value (in absolute value) of each point
+    std::vector<Value> myBestValues;
+
+  }; // end of class CandidatePointSetByRadixHeap
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/FMMCandidatePointSets.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FMMCandidatePointSets_h
+
+#undef FMMCandidatePointSets_RECURSES
+#endif // else defined(FMMCandidatePointSets_RECURSES)
@@ -0,0 +1,404 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file OutOfCoreVoronoiMap.h
+ * @brief Voronoi map computed slab by slab in a tiled image
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module OutOfCoreVoronoiMap.cpp
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testOutOfCoreVoronoiMap.cpp
+ */
+
+#if defined(OutOfCoreVoronoiMap_RECURSES)
+#error Recursive header files inclusion detected in OutOfCoreVoronoiMap.h
+#else // defined(OutOfCoreVoronoiMap_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define OutOfCoreVoronoiMap_RECURSES
+
+#if !defined OutOfCoreVoronoiMap_h
+/** Prevents repeated inclusion of headers. */
+#define OutOfCoreVoronoiMap_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/Executors.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/VoronoiRows.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OutOfCoreVoronoiMap
+  /**
+   * Description of template class 'OutOfCoreVoronoiMap' <p>
+   * \brief Aim: Computes the Voronoi map of VoronoiMap in a tiled
+   * image (e.g. TiledImageFromImage), for domains whose map does not
+   * fit in memory.
+   *
+   * The separable algorithm of VoronoiMap is used, but each step
+   * (dimension @a dim) is done slab by slab: a slab is a box of the
+   * domain containing complete 1D rows along @a dim. Its values are
+   * gathered tile by tile from the tiled image into a buffer (the
+   * only slab resident in memory), the 1D problems of the slab rows
+   * are solved in this buffer by the executor and the results are
+   * scattered back, tile by tile, to the tiled image. The tiles are
+   * hence streamed through the image cache in the order of the
+   * pass. The first step reads the point predicate instead of the
+   * image, no initialization pass is needed.
+   *
+   * The size of the slabs is given by a memory budget (in bytes) for
+   * the slab buffer: the cross-section of a slab is first one tile
+   * (or less if the budget is too small) and then grows by whole
+   * tiles, dimension 0 first, as long as the slab fits in the
+   * budget. The result does not depend on the memory budget.
+   *
+   * The tiled image should use a write-back policy
+   * (ImageCacheWritePolicyWB): each value of a tile is written once
+   * in the cache and the tile is written to the underlying image
+   * when it leaves the cache. If the read policy can hold all the
+   * tiles of a slab (e.g. ImageCacheReadPolicyFIFO with enough
+   * pages), the tiles gathered for a slab are still in the cache
+   * when the results are scattered. The tiled image is flushed at
+   * the end of the computation, the map is then available in the
+   * underlying image.
+   *
+   * @tparam TSpace type of Digital Space (model of CSpace).
+   * @tparam TPointPredicate point predicate returning true for points
+   * from which we compute the distance (model of CPointPredicate)
+   * @tparam TSeparableMetric a model of CSeparableMetric
+   * @tparam TTiledImage the tiled image storing the Voronoi map, with
+   * TSpace::Vector values and the findSubDomain() and flush() methods
+   * of TiledImageFromImage.
+   * @tparam TExecutor the executor running the 1D problems of a slab
+   * (default: DefaultExecutor, see Executors.h).
+   */
+  template < typename TSpace,
+             typename TPointPredicate,
+             typename TSeparableMetric,
+             typename TTiledImage,
+             typename TExecutor = DefaultExecutor
+             >
+  class OutOfCoreVoronoiMap
+  {
+
+  public:
+    BOOST_CONCEPT_ASSERT(( CSpace< TSpace > ));
+    BOOST_CONCEPT_ASSERT(( CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( CSeparableMetric<TSeparableMetric> ));
+
+    ///Both Space points and PointPredicate points must be the same.
+    BOOST_STATIC_ASSERT ((boost::is_same< typename TSpace::Point,
+                          typename TPointPredicate::Point >::value ));
+
+    //Tiled image value type must be TSpace::Vector
+    BOOST_STATIC_ASSERT ((boost::is_same< typename TSpace::Vector,
+                          typename TTiledImage::Value >::value ));
+
+    //Tiled image domain type must be HyperRectangular
+    BOOST_STATIC_ASSERT ((boost::is_same< HyperRectDomain<TSpace>,
+                          typename TTiledImage::Domain >::value ));
+
+    ///Copy of the space type.
+    typedef TSpace Space;
+
+    ///Copy of the point predicate type.
+    typedef TPointPredicate PointPredicate;
+
+    ///Definition of the underlying domain type.
+    typedef HyperRectDomain<TSpace> Domain;
+
+    ///Definition of the separable metric type
+    typedef TSeparableMetric SeparableMetric;
+
+    typedef typename Space::Vector Vector;
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+    typedef typename Space::Size Size;
+    typedef typename Space::Point::Coordinate Abscissa;
+
+    ///Type of the tiled image storing the map
+    typedef TTiledImage OutputImage;
+
+    ///Definition of the image value type.
+    typedef Vector Value;
+
+    ///Executor type
+    typedef TExecutor Executor;
+
+    ///Self type
+    typedef OutOfCoreVoronoiMap<TSpace, TPointPredicate,
+                                TSeparableMetric, TTiledImage, TExecutor> Self;
+
+    /**
+     * Constructor.
+     *
+     * Computes the Voronoi map of the predicate on the domain (see
+     * VoronoiMap) and stores it in the tiled image @a anImage, which
+     * is flushed at the end of the computation.
+     *
+     * @param aDomain the (hyper-rectangular) domain on which the
+     * computation is performed, it must be the domain of the tiled
+     * image.
+     *
+     * @param aPredicate the point predicate to define the Voronoi
+     * sites (false points).
+     *
+     * @param aMetric the separable metric instance.
+     *
+     * @param anImage the tiled image storing the Voronoi map.
+     *
+     * @param aMemoryBudget size in bytes of the slab buffer (at least
+     * one row is processed at once).
+     */
+    OutOfCoreVoronoiMap(ConstAlias<Domain> aDomain,
+                        ConstAlias<PointPredicate> aPredicate,
+                        ConstAlias<SeparableMetric> aMetric,
+                        Alias<OutputImage> anImage,
+                        const std::size_t aMemoryBudget = 64*1024*1024);
+
+    /**
+     * Default destructor
+     */
+    ~OutOfCoreVoronoiMap();
+
+  public:
+
+    /**
+     * Returns a reference (const) to the Voronoi map domain.
+     * @return a domain
+     */
+    const Domain & domain() const
+    {
+      return *myDomainPtr;
+    }
+
+    /**
+     * Access to a Voronoi value (a.k.a. vector to the closest site)
+     * at a point (through the tiled image).
+     *
+     * @param aPoint the point to probe.
+     */
+    Value operator()(const Point &aPoint) const
+    {
+      return myImagePtr->operator()(aPoint);
+    }
+
+    /**
+     * @return Returns an alias to the underlying metric.
+     */
+    const SeparableMetric* metric() const
+    {
+      return myMetricPtr;
+    }
+
+    /**
+     * @return the memory budget (in bytes) of the slab buffer.
+     */
+    std::size_t memoryBudget() const
+    {
+      return myMemoryBudget;
+    }
+
+    /**
+     * @return the number of slabs processed by the computation (all
+     * the steps).
+     */
+    std::size_t nbSlabs() const
+    {
+      return myNbSlabs;
+    }
+
+    /**
+     * Self Display method.
+     *
+     * @param out output stream
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------- Private functions ------------------------
+  private:
+
+    ///Solver of the 1D problems
+    typedef VoronoiRows<SeparableMetric, Point> Rows;
+
+    ///Per worker buffers of the 1D problems
+    typedef typename Rows::LineBuffer LineBuffer;
+
+    /**
+     * Computes the Voronoi map, step by step.
+     */
+    void compute();
+
+    /**
+     * Computes the step @a dim of the separable Voronoi map, slab by
+     * slab.
+     *
+     * @param [in] dim the dimension to process.
+     * @param [in,out] slab the slab buffer.
+     * @param [in,out] sites per worker site buffers.
+     */
+    void computeStep(const Dimension dim,
+                     std::vector<Value> &slab,
+                     std::vector<LineBuffer> &sites);
+
+    /**
+     * @param [in] dim the dimension to process.
+     * @return the extent of the slabs of the step @a dim (the extent
+     * along @a dim is the domain one).
+     */
+    Point slabExtent(const Dimension dim) const;
+
+    /**
+     * Moves @a aBoxStart to the first point of the next box of a grid
+     * of boxes (tiles or slabs) covering [@a lower, @a upper], the
+     * boxes being visited dimension 0 first.
+     *
+     * @param [in,out] aBoxStart lower bound of the current box.
+     * @param [in] aBoxUpper upper bound of the current box.
+     * @param [in] lower lower bound of the grid.
+     * @param [in] upper upper bound of the grid.
+     * @return 'false' if the current box was the last one.
+     */
+    bool nextBox(Point &aBoxStart, const Point &aBoxUpper,
+                 const Point &lower, const Point &upper) const;
+
+    /**
+     * Task functor solving the 1D problem of the row of a given index
+     * in the slab [lower, upper], with the buffer of the worker
+     * running it.
+     */
+    struct RowTask
+    {
+      const Self * voronoiMap;
+      Dimension dim;
+      Point lower;
+      Point upper;
+      Value * slab;
+      std::vector<LineBuffer> * sites;
+
+      void operator()(const std::size_t worker, const std::size_t aRow) const
+      {
+        //Row index as a mixed radix number, dimension 0 first
+        Point row = lower;
+        std::size_t index = aRow;
+        for ( Dimension k = 0; k < Space::dimension ; k++)
+          if ( k != dim )
+            {
+              const std::size_t radix = upper[k] - lower[k] + 1;
+              row[k] += (Abscissa) ( index % radix );
+              index /= radix;
+            }
+        const Size n = upper[dim] - lower[dim] + 1;
+        Rows::solve( *voronoiMap->myMetricPtr, row, dim,
+                     voronoiMap->myLowerBoundCopy[dim], voronoiMap->myUpperBoundCopy[dim],
+                     voronoiMap->myInfinity, slab + aRow * n, (*sites)[ worker ] );
+      }
+    };
+    friend struct RowTask;
+
+    /**
+     * Copy constructor. Forbidden.
+     */
+    OutOfCoreVoronoiMap(const Self &other);
+
+    /**
+     * Assignment. Forbidden.
+     */
+    Self & operator=(const Self &other);
+
+    // ------------------- Private members ------------------------
+  private:
+
+    ///Pointer to the computation domain
+    const Domain * myDomainPtr;
+
+    ///Pointer to the point predicate
+    const PointPredicate * myPointPredicatePtr;
+
+    ///Pointer to the separable metric instance
+    const SeparableMetric * myMetricPtr;
+
+    ///Pointer to the tiled image
+    OutputImage * myImagePtr;
+
+    ///Memory budget of the slab buffer (in bytes)
+    std::size_t myMemoryBudget;
+
+    ///Number of processed slabs
+    std::size_t myNbSlabs;
+
+    ///Copy of the image lower bound
+    Point myLowerBoundCopy;
+
+    ///Copy of the image upper bound
+    Point myUpperBoundCopy;
+
+    ///Value to act as a +infinity value
+    Point myInfinity;
+
+    ///Executor running the 1D problems
+    Executor myExecutor;
+
+  }; // end of class OutOfCoreVoronoiMap
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'OutOfCoreVoronoiMap'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'OutOfCoreVoronoiMap' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename S, typename P,
+            typename Sep, typename TI, typename TE>
+  std::ostream&
+  operator<< ( std::ostream & out, const OutOfCoreVoronoiMap<S,P,Sep,TI,TE> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/OutOfCoreVoronoiMap.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined OutOfCoreVoronoiMap_h
+
+#undef OutOfCoreVoronoiMap_RECURSES
+#endif // else defined(OutOfCoreVoronoiMap_RECURSES)
@@ -45,6 +45,7 @@
 #include <iostream>
 #include <utility>
 #include <vector>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
@@ -52,6 +53,8 @@
 #include "DGtal/images/CConstImage.h"
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/Executors.h"
+#include "DGtal/geometry/volumes/distance/SeparableBlocks.h"
 #include "DGtal/geometry/volumes/distance/CPowerSeparableMetric.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 //////////////////////////////////////////////////////////////////////////////
@@ -81,6 +84,11 @@ namespace DGtal
    * class constructor). For Euclidean the @f$ l_2@f$ metric, the
    * overall computation is in @f$ O(d.n^d)@f$, which is optimal.
    *
+   * As in VoronoiMap, the 1D problems along dimensions @a dim > 0 are
+   * processed by blocks of consecutive rows along dimension 0 which
+   * are gathered into (and scattered back from) a contiguous buffer.
+   * These blocks are run by the executor @a TExecutor.
+   *
    * This class is a model of CConstImage.
    *
    * @tparam TWeightImage model of CConstImage
@@ -90,12 +98,15 @@ namespace DGtal
    * image container and the TSpace should match. Furthermore the
    * container value type must be TSpace::Vector. Lastly, the domain
    * of the container must be HyperRectDomain.
+   * @tparam TExecutor the executor running the blocks of 1D problems
+   * (default: DefaultExecutor, see Executors.h).
     */
   template < typename TWeightImage,
              typename TPowerSeparableMetric,
              typename TImageContainer = 
              ImageContainerBySTLVector<HyperRectDomain<typename TWeightImage::Domain::Space>,
-                                       typename TWeightImage::Domain::Space::Vector> >
+                                       typename TWeightImage::Domain::Space::Vector>,
+             typename TExecutor = DefaultExecutor >
   class PowerMap
   {
 
@@ -140,8 +151,11 @@ namespace DGtal
     ///Definition of the image value type.
     typedef typename OutputImage::ConstRange  ConstRange;
   
+    ///Executor type
+    typedef TExecutor Executor;
+
     ///Self type
-  typedef PowerMap<TWeightImage, TPowerSeparableMetric, TImageContainer> Self;
+  typedef PowerMap<TWeightImage, TPowerSeparableMetric, TImageContainer, TExecutor> Self;
     
 
     /**
@@ -160,10 +174,15 @@ namespace DGtal
      * returning the weight for some points
      * @param aMetric a power
      * seprable metric instance.
+     * @param aBlockSize number of consecutive rows (along dimension
+     * 0) processed together for the steps @a dim > 0 (must be
+     * strictly positive, 1 corresponds to the row by row
+     * computation).
      */
     PowerMap(ConstAlias<Domain> aDomain,
              ConstAlias<WeightImage> aWeightImage,
-             ConstAlias<PowerSeparableMetric> aMetric);
+             ConstAlias<PowerSeparableMetric> aMetric,
+             const Size aBlockSize = 16);
 
     /**
      * Default destructor
@@ -249,19 +268,73 @@ namespace DGtal
      *  Compute the other steps of the separable Power map.
      * 
      * @param dim the dimension to process
+     * @param blocks per worker block buffers.
+     * @param sites per worker site buffers.
      */    
-    void computeOtherSteps(const Dimension dim) const;
+    void computeOtherSteps(const Dimension dim,
+                           std::vector< std::vector<Value> > & blocks,
+                           std::vector< std::vector<Point> > & sites) const;
+
     /** 
-     * Given  a voronoi map valid at dimension @a dim-1, this method
+     * Given a power map valid at dimension @a dim-1, this method
      * updates the map to make it consistent at dimension @a dim along
-     * the 1D span starting at @a row along the dimension @a
-     * dim.
+     * the @a width 1D spans starting at @a row, @a row + e_0, ...,
+     * @a row + (@a width-1).e_0 along the dimension @a dim.
+     * 
+     * @param row starting point of the first 1D span.
+     * @param width number of 1D spans of the block (should be 1 if
+     * @a dim is 0).
+     * @param dim dimension of the update.
+     * @param block a buffer to store the block values.
+     * @param Sites a buffer to store the sites of a span.
+     */
+    void computeOtherStepBlock (const Point &row,
+                                const Size width,
+                                const Size dim,
+                                std::vector<Value> &block,
+                                std::vector<Point> &Sites) const;
+
+    /** 
+     * Given  a power map valid at dimension @a dim-1, this method
+     * updates the map values of the 1D span starting at @a row along
+     * the dimension @a dim. The values of the span are read from and
+     * written to the contiguous buffer @a values.
      * 
      * @param row starting point of the 1D process.
      * @param dim dimension of the update.
+     * @param values the span values
+     * (myUpperBoundCopy[dim]-myLowerBoundCopy[dim]+1 elements).
+     * @param Sites a buffer to store the sites of the span.
      */
     void computeOtherStep1D (const Point &row, 
-			     const Size dim) const;
+			     const Size dim,
+                             Value *values,
+                             std::vector<Point> &Sites) const;
+
+    /**
+     * Task functor solving the 1D problems of the block of a given
+     * index (see computeOtherSteps), with the buffers of the worker
+     * running it.
+     */
+    struct BlockTask
+    {
+      const Self * powerMap;
+      Dimension dim;
+      Size width;
+      std::vector< std::vector<Value> > * blocks;
+      std::vector< std::vector<Point> > * sites;
+
+      void operator()(const std::size_t worker, const std::size_t aBlock) const
+      {
+        const Point start = SeparableBlocks<Point>::startingPoint
+          ( aBlock, dim, width, powerMap->myLowerBoundCopy, powerMap->myUpperBoundCopy );
+        const Size w = SeparableBlocks<Point>::spans( start, dim, width,
+                                                      powerMap->myUpperBoundCopy );
+        powerMap->computeOtherStepBlock( start, w, dim,
+                                         (*blocks)[ worker ], (*sites)[ worker ] );
+      }
+    };
+    friend struct BlockTask;
     
     // ------------------- protected methods ------------------------
   protected:
@@ -288,7 +361,13 @@ namespace DGtal
     ///Value to act as a +infinity value
     Point myInfinity;
 
+    ///Number of rows processed together for dimensions > 0
+    Size myBlockSize;
+
   protected:
+    ///Executor running the blocks of 1D problems
+    Executor myExecutor;
+
     ///Pointer to the separable metric instance
     const PowerSeparableMetric * myMetricPtr;
     
@@ -309,9 +388,10 @@ namespace DGtal
    */
   template <typename W,
             typename Sep,
-            typename Image>
+            typename Image,
+            typename TE>
   std::ostream&
-  operator<< ( std::ostream & out, const PowerMap<W,Sep,Image> & object );
+  operator<< ( std::ostream & out, const PowerMap<W,Sep,Image,TE> & object );
 
 } // namespace DGtal
 
@@ -45,7 +45,10 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <utility>
+#include <algorithm>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/Executors.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/geometry/volumes/distance/CPowerSeparableMetric.h"
@@ -100,6 +103,18 @@ namespace DGtal
     //MA Container
     typedef Image<TImageContainer> Type;
 
+    ///Point type
+    typedef typename TPowerMap::Point Point;
+
+    ///Weight type of the power map sites
+    typedef typename TPowerMap::Weight Weight;
+
+    ///Medial axis ball (center, weight)
+    typedef std::pair<Point, Weight> Ball;
+
+    ///Compact medial axis, sorted by ball centers
+    typedef std::vector<Ball> Balls;
+
     /** 
      * Extract reduced medial axis from a power map.
      * This methods is in @f$ O(|powerMap|)@f$. 
@@ -112,23 +127,142 @@ namespace DGtal
     static 
     Type getReducedMedialAxisFromPowerMap(const TPowerMap &aPowerMap) 
     {
-      typename TPowerMap::Value v;
+      Balls balls;
+      getReducedMedialAxisBallsFromPowerMap( aPowerMap, balls );
+
       TImageContainer *computedMA = new TImageContainer( aPowerMap.domain() );
-      for (typename TPowerMap::Domain::ConstIterator it = aPowerMap.domain().begin(), 
-             itend = aPowerMap.domain().end(); it != itend; ++it)
-        {
-          v =  aPowerMap(*it);
-          if  (aPowerMap.metricPtr()->powerDistance(*it, 
-                                                    v,
-                                                    aPowerMap.weightImagePtr()->operator()( v )) 
-               < NumberTraits<typename TPowerMap::PowerSeparableMetric::Value>::ZERO )
-            
-            computedMA->setValue( v,
-                                  aPowerMap.weightImagePtr()->operator()( v ));
-
-        }
+      for (typename Balls::const_iterator it = balls.begin(), itend = balls.end();
+           it != itend; ++it)
+        computedMA->setValue( it->first, it->second );
       return Type( computedMA );
     }
+
+    /** 
+     * Extract reduced medial axis from a power map as a compact array
+     * of balls (center, weight) sorted by centers (lexicographic
+     * order of the points), each ball appearing once.
+     *
+     * The rows of the power map domain (along dimension 0) are
+     * scanned in parallel by @a aExecutor; the weight of a site is
+     * only read when the site changes along a row, and no longer
+     * tested along the row once found on the medial axis.
+     * This methods is in @f$ O(|powerMap| + m.log(m))@f$, @a m
+     * being the number of medial axis balls.
+     *
+     * @tparam TExecutor the type of executor (see Executors.h).
+     * @param aPowerMap the input powerMap
+     * @param aBalls the output balls (previous content is erased).
+     * @param aExecutor the executor scanning the rows.
+     */
+    template <typename TExecutor>
+    static 
+    void getReducedMedialAxisBallsFromPowerMap(const TPowerMap &aPowerMap,
+                                               Balls &aBalls,
+                                               const TExecutor &aExecutor) 
+    {
+      const typename TPowerMap::Domain &domain = aPowerMap.domain();
+      std::size_t nbRows = 1;
+      for (Dimension k = 1; k < Point::dimension; ++k)
+        nbRows *= domain.upperBound()[k] - domain.lowerBound()[k] + 1;
+
+      //Per worker balls, merged afterwards
+      std::vector<Balls> balls( aExecutor.nbWorkers() );
+      RowTask task = { &aPowerMap, &balls };
+      aExecutor.run( nbRows, task );
+
+      aBalls.clear();
+      for (typename std::vector<Balls>::const_iterator it = balls.begin(), 
+             itend = balls.end(); it != itend; ++it)
+        aBalls.insert( aBalls.end(), it->begin(), it->end() );
+      std::sort( aBalls.begin(), aBalls.end(), BallLess() );
+      aBalls.erase( std::unique( aBalls.begin(), aBalls.end(), BallEqual() ), 
+                    aBalls.end() );
+    }
+
+    /** 
+     * Extract reduced medial axis from a power map as a compact array
+     * of balls, with the default executor (see
+     * getReducedMedialAxisBallsFromPowerMap above).
+     *
+     * @param aPowerMap the input powerMap
+     * @param aBalls the output balls (previous content is erased).
+     */
+    static 
+    void getReducedMedialAxisBallsFromPowerMap(const TPowerMap &aPowerMap,
+                                               Balls &aBalls) 
+    {
+      getReducedMedialAxisBallsFromPowerMap( aPowerMap, aBalls, DefaultExecutor() );
+    }
+
+  private:
+
+    ///Order of the balls by centers
+    struct BallLess
+    {
+      bool operator()(const Ball &a, const Ball &b) const
+      {
+        return a.first < b.first;
+      }
+    };
+
+    ///Equality of the ball centers
+    struct BallEqual
+    {
+      bool operator()(const Ball &a, const Ball &b) const
+      {
+        return a.first == b.first;
+      }
+    };
+
+    /**
+     * Task functor collecting the medial axis balls of a given row
+     * of the power map domain (along dimension 0) into the balls of
+     * the worker running it.
+     */
+    struct RowTask
+    {
+      const TPowerMap * powerMap;
+      std::vector<Balls> * balls;
+
+      void operator()(const std::size_t worker, std::size_t aRow) const
+      {
+        const typename TPowerMap::Domain &domain = powerMap->domain();
+        Point p = domain.lowerBound();
+        for (Dimension k = 1; k < Point::dimension; ++k)
+          {
+            const std::size_t extent = domain.upperBound()[k] - domain.lowerBound()[k] + 1;
+            p[k] += (typename Point::Coordinate) ( aRow % extent );
+            aRow /= extent;
+          }
+
+        Balls &out = (*balls)[ worker ];
+        typename TPowerMap::Value site;
+        Weight weight = Weight();
+        //site of the last ball found or without weight
+        bool skipSite = false;
+        for (typename Point::Coordinate x = domain.lowerBound()[0],
+               xEnd = domain.upperBound()[0]; x <= xEnd; ++x)
+          {
+            p[0] = x;
+            const typename TPowerMap::Value v = (*powerMap)( p );
+            if ( (x == domain.lowerBound()[0]) || (v != site) )
+              {
+                site = v;
+                skipSite = !powerMap->weightImagePtr()->domain().isInside( v );
+                if ( !skipSite )
+                  weight = powerMap->weightImagePtr()->operator()( v );
+              }
+            if ( !skipSite &&
+                 ( powerMap->metricPtr()->powerDistance( p, v, weight ) 
+                   < NumberTraits<typename TPowerMap::PowerSeparableMetric::Value>::ZERO ) )
+              {
+                out.push_back( Ball( v, weight ) );
+                skipSite = true;
+              }
+          }
+      }
+    };
+    friend struct RowTask;
   }; // end of class ReducedMedialAxis
 
 
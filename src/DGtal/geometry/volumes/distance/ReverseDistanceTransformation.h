@@ -45,6 +45,7 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/kernel/CPointPredicate.h"
@@ -84,15 +85,19 @@ namespace DGtal
    * PowerMap (default: ImageContainerBySTLVector). The space of the
    * image container and the TSpace should match. Furthermore the
    * container value type must be TSpace::Vector.
+   * @tparam TExecutor the executor running the separable steps
+   * (default: DefaultExecutor, see Executors.h).
    */
   template < typename TWeightImage,
              typename TPSeparableMetric,
 	     typename TImageContainer = 
              ImageContainerBySTLVector<HyperRectDomain<typename TWeightImage::Domain::Space>,
-                                       typename TWeightImage::Domain::Space::Vector> >
+                                       typename TWeightImage::Domain::Space::Vector>,
+             typename TExecutor = DefaultExecutor >
   class ReverseDistanceTransformation: public PowerMap<TWeightImage,
 						       TPSeparableMetric, 
-						       TImageContainer>
+						       TImageContainer,
+                                                       TExecutor>
   {
 
   public:
@@ -122,28 +127,29 @@ namespace DGtal
     ///Definition of the image.
     typedef  ReverseDistanceTransformation<TWeightImage,
                                            TPSeparableMetric,
-                                           TImageContainer> Self;
+                                           TImageContainer,
+                                           TExecutor> Self;
     
-    typedef PowerMap<TWeightImage,TPSeparableMetric> Parent;
+    typedef PowerMap<TWeightImage,TPSeparableMetric,
+                     TImageContainer,TExecutor> Parent;
    
     ///Definition of the image constRange
     typedef  DefaultConstImageRange<Self> ConstRange;
 
 
     ///Definition of the image value type.
-    typedef typename PowerMap<TWeightImage,TPSeparableMetric,
-			      TImageContainer>::Domain  Domain;
+    typedef typename Parent::Domain  Domain;
     
 
     /**
      *  Constructor
+     * See documentation of PowerMap constructor.
      */
     ReverseDistanceTransformation(ConstAlias<Domain> aDomain,
                                   ConstAlias<WeightImage> aWeightImage,
-                                  ConstAlias<PowerSeparableMetric> aMetric):
-      PowerMap<TWeightImage,TPSeparableMetric,TImageContainer>(aDomain,
-                                                               aWeightImage,
-                                                               aMetric)
+                                  ConstAlias<PowerSeparableMetric> aMetric,
+                                  const typename TWeightImage::Domain::Space::Size aBlockSize = 16):
+      Parent(aDomain, aWeightImage, aMetric, aBlockSize)
     {}
     
     /**
@@ -204,6 +210,37 @@ namespace DGtal
       return Parent::metricPtr();
     }
 
+    /**
+     * Rasterizes the reconstructed shape, i.e. the points with
+     * negative power distance, into a label image: the points of the
+     * shape are set to @a aInside, the others to @a aOutside.
+     *
+     * The values are directly written through the iterators of the
+     * image in the linearized order of the domain, by chunks of
+     * consecutive points run by the executor. The weight of a site is
+     * only read when the site changes along the scan.
+     *
+     * @tparam TImage model of CImage with a random access iterator
+     * range in the linearized order of the domain
+     * (e.g. ImageContainerBySTLVector, including bool values).
+     * @param aImage the output image, defined on the domain of the
+     * reverse distance transformation.
+     * @param aInside label of the points of the shape.
+     * @param aOutside label of the other points.
+     */
+    template <typename TImage>
+    void rasterize(TImage & aImage,
+                   const typename TImage::Value & aInside,
+                   const typename TImage::Value & aOutside) const
+    {
+      ASSERT( aImage.domain().lowerBound() == domain().lowerBound() );
+      ASSERT( aImage.domain().upperBound() == domain().upperBound() );
+
+      const std::size_t n = domain().size();
+      RasterizeTask<TImage> task = { this, &aImage, aInside, aOutside, n };
+      this->myExecutor.run( (n + chunkSize - 1) / chunkSize, task );
+    }
+
     /** 
      * Self Display method.
      * 
@@ -229,17 +266,85 @@ namespace DGtal
     // ------------------- Private members ------------------------
   private:
 
+    /// Number of points of the chunks of rasterize(), a multiple of
+    /// the word size so that two chunks never share a word of a
+    /// packed boolean image.
+    static const std::size_t chunkSize = 4096;
+
+    /**
+     * Task functor writing the labels of the points of a given chunk
+     * of the linearized domain (see rasterize).
+     */
+    template <typename TImage>
+    struct RasterizeTask
+    {
+      const Self * rdt;
+      TImage * image;
+      typename TImage::Value inside;
+      typename TImage::Value outside;
+      std::size_t size;
+
+      void operator()(const std::size_t, const std::size_t aChunk) const
+      {
+        const Point & lower = rdt->domain().lowerBound();
+        const Point & upper = rdt->domain().upperBound();
+        std::size_t i = aChunk * chunkSize;
+        const std::size_t iEnd = std::min( i + chunkSize, size );
+
+        //First point of the chunk
+        Point p = lower;
+        std::size_t r = i;
+        for ( Dimension k = 0; k < Point::dimension; ++k )
+          {
+            const std::size_t extent = upper[k] - lower[k] + 1;
+            p[k] += (typename Point::Coordinate) ( r % extent );
+            r /= extent;
+          }
+
+        Vector site;
+        Weight weight = Weight();
+        bool hasWeight = false;
+        typename TImage::Iterator it = image->begin() + i;
+        for ( ; i < iEnd; ++i, ++it )
+          {
+            const Vector v = rdt->myImagePtr->operator()( p );
+            if ( (i == aChunk * chunkSize) || (v != site) )
+              {
+                site = v;
+                hasWeight = rdt->myWeightImagePtr->domain().isInside( v );
+                if ( hasWeight )
+                  weight = rdt->myWeightImagePtr->operator()( v );
+              }
+            *it = ( hasWeight &&
+                    ( rdt->myMetricPtr->powerDistance( p, v, weight )
+                      < NumberTraits<Value>::ZERO ) ) ? inside : outside;
+
+            //Next point in the linearized order
+            for ( Dimension k = 0; k < Point::dimension; ++k )
+              {
+                if ( p[k] < upper[k] )
+                  {
+                    ++p[k];
+                    break;
+                  }
+                p[k] = lower[k];
+              }
+          }
+      }
+    };
+    template <typename TImage> friend struct RasterizeTask;
+
   }; // end of class ReverseDistanceTransformation
 
 
 // //                                                                           //
 // ///////////////////////////////////////////////////////////////////////////////
   
-  template <typename W,typename TSep>
+  template <typename W,typename TSep,typename TImage,typename TE>
   inline
   std::ostream&
   operator<< ( std::ostream & out, 
-               const ReverseDistanceTransformation<W,TSep> & object )
+               const ReverseDistanceTransformation<W,TSep,TImage,TE> & object )
   {
     object.selfDisplay( out );
     return out;
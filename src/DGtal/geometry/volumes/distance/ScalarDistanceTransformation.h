@@ -0,0 +1,425 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ScalarDistanceTransformation.h
+ * @brief Linear in time distance transformation with scalar output
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ScalarDistanceTransformation.ih
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testScalarDistanceTransformation.cpp
+ */
+
+#if defined(ScalarDistanceTransformation_RECURSES)
+#error Recursive header files inclusion detected in ScalarDistanceTransformation.h
+#else // defined(ScalarDistanceTransformation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ScalarDistanceTransformation_RECURSES
+
+#if !defined ScalarDistanceTransformation_h
+/** Prevents repeated inclusion of headers. */
+#define ScalarDistanceTransformation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <utility>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/base/Executors.h"
+#include "DGtal/geometry/volumes/distance/SeparableBlocks.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/geometry/volumes/distance/CPowerSeparableMetric.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ScalarDistanceTransformation
+  /**
+   * Description of template class 'ScalarDistanceTransformation' <p>
+   * \brief Aim: Implementation of the linear in time distance
+   * transformation writing scalar values into a caller-supplied
+   * image.
+   *
+   * Contrary to DistanceTransformation, which stores the closest site
+   * of each point (a Point per point) and computes the distance at
+   * each access, this class only stores one scalar per point: the
+   * power distance representation of the metric (e.g. the squared
+   * Euclidean distance for the exact @f$ l_2@f$ metric), optionally
+   * transformed by a functor at the last step (e.g. a square root to
+   * get floating point distances).
+   *
+   * The separable process is the one of VoronoiMap, but the value
+   * stored between two steps is the partial distance @f$ h@f$ to the
+   * closest site in the already processed dimensions. Along a line,
+   * the 1D problem is then a power diagram: a point @a i of the line
+   * with partial distance @f$ h_i@f$ is a site of weight @f$
+   * -h_i@f$, and the new partial distance at @a x is @f$ h_i +
+   * |x-i|^p@f$ for the closest site. Hence, the metric must be a model
+   * of CPowerSeparableMetric (e.g. ExactPredicateLpPowerSeparableMetric)
+   * and the sites of a line are only kept in a per worker buffer. As
+   * in VoronoiMap, the 1D problems are processed by blocks of
+   * consecutive rows and run by an executor.
+   *
+   * The output image stores the intermediate values, they must be
+   * exactly representable by its value type (e.g. squared
+   * distances less than @f$ 2^{24}@f$ for a @a float image). Points
+   * without site in the whole domain get the value infinity().
+   *
+   * @code
+   * typedef ExactPredicateLpPowerSeparableMetric<Z3i::Space, 2> L2;
+   * typedef ImageContainerBySTLVector<Z3i::Domain, DGtal::uint32_t> Image;
+   * Image squaredDistances( domain );
+   * L2 l2;
+   * ScalarDistanceTransformation<Z3i::DigitalSet, L2, Image>
+   *   dt( domain, set, l2, squaredDistances );
+   * @endcode
+   *
+   * This class is a model of CConstImage.
+   *
+   * @tparam TPointPredicate point predicate returning true for points
+   * from which we compute the distance (model of CPointPredicate).
+   * @tparam TPowerSeparableMetric a model of CPowerSeparableMetric
+   * with integral weights.
+   * @tparam TImageContainer any model of CImage with an
+   * HyperRectDomain and a scalar value type, to store the result.
+   * @tparam TFunctor functor applied to the power distance
+   * representations (type TPowerSeparableMetric::Weight) at the last
+   * step (default: CastFunctor to the image value type).
+   * @tparam TExecutor the executor running the 1D problems (default:
+   * DefaultExecutor, see Executors.h).
+   *
+   * @see DistanceTransformation
+   */
+  template < typename TPointPredicate,
+             typename TPowerSeparableMetric,
+             typename TImageContainer,
+             typename TFunctor = CastFunctor<typename TImageContainer::Value>,
+             typename TExecutor = DefaultExecutor >
+  class ScalarDistanceTransformation
+  {
+
+  public:
+    BOOST_CONCEPT_ASSERT(( CPointPredicate<TPointPredicate> ));
+    BOOST_CONCEPT_ASSERT(( CPowerSeparableMetric<TPowerSeparableMetric> ));
+    BOOST_CONCEPT_ASSERT(( CImage<TImageContainer> ));
+
+    ///Copy of the image types
+    typedef TImageContainer OutputImage;
+    typedef typename OutputImage::Domain Domain;
+    typedef typename Domain::Space Space;
+    typedef typename Space::Point Point;
+    typedef typename Space::Dimension Dimension;
+    typedef typename Space::Size Size;
+    typedef typename Point::Coordinate Abscissa;
+
+    //Both Space points and PointPredicate points must be the same.
+    BOOST_STATIC_ASSERT ((boost::is_same< Point,
+                          typename TPointPredicate::Point >::value ));
+
+    //ImageContainer domain type must be  HyperRectangular
+    BOOST_STATIC_ASSERT ((boost::is_same< HyperRectDomain<Space>, Domain >::value ));
+
+    ///Point predicate type
+    typedef TPointPredicate PointPredicate;
+
+    ///Power separable metric type
+    typedef TPowerSeparableMetric PowerSeparableMetric;
+
+    ///Type of the power distance representations
+    typedef typename PowerSeparableMetric::Weight Weight;
+
+    ///Definition of the image value type.
+    typedef typename OutputImage::Value Value;
+
+    ///Definition of the image constRange.
+    typedef typename OutputImage::ConstRange ConstRange;
+
+    ///Functor applied at the last step
+    typedef TFunctor Functor;
+
+    ///Executor type
+    typedef TExecutor Executor;
+
+    ///Self type
+    typedef ScalarDistanceTransformation<TPointPredicate, TPowerSeparableMetric,
+                                         TImageContainer, TFunctor, TExecutor> Self;
+
+    /**
+     * Constructor. Computes the distance transformation of the points
+     * satisfying the predicate into the image @a anImage.
+     *
+     * @param aDomain the (hyper-rectangular) domain on which the
+     * computation is performed (should be included in the image
+     * domain).
+     * @param aPredicate the point predicate (sites are false points).
+     * @param aMetric the power separable metric instance.
+     * @param anImage the image storing the result (aliased).
+     * @param aFunctor functor applied at the last step.
+     * @param aBlockSize number of consecutive rows (along dimension
+     * 0) processed together for the steps @a dim > 0 (must be
+     * strictly positive).
+     */
+    ScalarDistanceTransformation(ConstAlias<Domain> aDomain,
+                                 ConstAlias<PointPredicate> aPredicate,
+                                 ConstAlias<PowerSeparableMetric> aMetric,
+                                 Alias<OutputImage> anImage,
+                                 const Functor & aFunctor = Functor(),
+                                 const Size aBlockSize = 16);
+
+    /**
+     * Default destructor
+     */
+    ~ScalarDistanceTransformation();
+
+    // ------------------- ConstImage model ------------------------
+  public:
+
+    /**
+     * Returns a reference (const) to the computation domain.
+     * @return a domain
+     */
+    const Domain & domain() const
+    {
+      return *myDomainPtr;
+    }
+
+    /**
+     * Returns a const range on the image values.
+     * @return a const range
+     */
+    ConstRange constRange() const
+    {
+      return myImagePtr->constRange();
+    }
+
+    /**
+     * Access to a distance value at a point.
+     *
+     * @param aPoint the point to probe.
+     * @return the value of the image at @a aPoint.
+     */
+    Value operator()(const Point &aPoint) const
+    {
+      return myImagePtr->operator()(aPoint);
+    }
+
+    /**
+     * @return the value of points without site (largest value of
+     * the Value type).
+     */
+    static Value infinity()
+    {
+      return std::numeric_limits<Value>::max();
+    }
+
+    /**
+     * @return Returns an alias to the underlying metric.
+     */
+    const PowerSeparableMetric* metricPtr() const
+    {
+      return myMetricPtr;
+    }
+
+    /**
+     * Self Display method.
+     *
+     * @param out output stream
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------- Private functions ------------------------
+  private:
+
+    /// A site of a line: its abscissa and its partial distance.
+    typedef std::pair<Abscissa, Weight> Site;
+
+    /**
+     * Computes the distance transformation.
+     */
+    void compute();
+
+    /**
+     * Computes the step @a dim of the separable process.
+     *
+     * @param [in] dim the dimension to process.
+     * @param [in,out] blocks per worker block buffers.
+     * @param [in,out] sites per worker site buffers.
+     */
+    void computeStep(const Dimension dim,
+                     std::vector< std::vector<Weight> > & blocks,
+                     std::vector< std::vector<Site> > & sites) const;
+
+    /**
+     * Processes the @a width 1D spans along @a dim starting at @a
+     * row, @a row + e_0, ..., @a row + (@a width-1).e_0 (gathered into
+     * a contiguous buffer). The step 0 reads the predicate, the other
+     * ones read the image.
+     *
+     * @param [in] row starting point of the first 1D span.
+     * @param [in] width number of 1D spans of the block (should be 1
+     * if @a dim is 0).
+     * @param [in] dim dimension of the step.
+     * @param [in,out] block a buffer to store the block values.
+     * @param [in,out] Sites a buffer to store the sites of a span.
+     */
+    void computeStepBlock(const Point &row,
+                          const Size width,
+                          const Dimension dim,
+                          std::vector<Weight> &block,
+                          std::vector<Site> &Sites) const;
+
+    /**
+     * Solves the 1D problem of the span starting at @a row along @a
+     * dim: the partial distances @a values are replaced by the ones
+     * of the step @a dim.
+     *
+     * @param [in] row starting point of the span.
+     * @param [in] dim dimension of the step.
+     * @param [in,out] values the span values (myInfinity if no site).
+     * @param [in,out] Sites a buffer to store the sites of the span.
+     */
+    void computeStep1D(const Point &row,
+                       const Dimension dim,
+                       Weight *values,
+                       std::vector<Site> &Sites) const;
+
+    /**
+     * Task functor solving the 1D problems of the block of a given
+     * index (see computeStep), with the buffers of the worker
+     * running it.
+     */
+    struct BlockTask
+    {
+      const Self * transformation;
+      Dimension dim;
+      Size width;
+      std::vector< std::vector<Weight> > * blocks;
+      std::vector< std::vector<Site> > * sites;
+
+      void operator()(const std::size_t worker, const std::size_t aBlock) const
+      {
+        const Point start = SeparableBlocks<Point>::startingPoint
+          ( aBlock, dim, width, transformation->myLowerBoundCopy,
+            transformation->myUpperBoundCopy );
+        const Size w = SeparableBlocks<Point>::spans( start, dim, width,
+                                                      transformation->myUpperBoundCopy );
+        transformation->computeStepBlock( start, w, dim,
+                                          (*blocks)[ worker ], (*sites)[ worker ] );
+      }
+    };
+    friend struct BlockTask;
+
+    // ------------------- Private members ------------------------
+  private:
+
+    ///Pointer to the computation domain
+    const Domain * myDomainPtr;
+
+    ///Pointer to the point predicate
+    const PointPredicate * myPointPredicatePtr;
+
+    ///Pointer to the separable metric instance
+    const PowerSeparableMetric * myMetricPtr;
+
+    ///Pointer to the output image
+    OutputImage * myImagePtr;
+
+    ///Functor applied at the last step
+    Functor myFunctor;
+
+    ///Copy of the domain lower bound
+    Point myLowerBoundCopy;
+
+    ///Copy of the domain upper bound
+    Point myUpperBoundCopy;
+
+    ///Partial distance acting as a +infinity value
+    Weight myInfinity;
+
+    ///Number of rows processed together for dimensions > 0
+    Size myBlockSize;
+
+    ///Executor running the 1D problems
+    Executor myExecutor;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    ScalarDistanceTransformation ( const ScalarDistanceTransformation & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    ScalarDistanceTransformation & operator= ( const ScalarDistanceTransformation & other );
+
+  }; // end of class ScalarDistanceTransformation
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ScalarDistanceTransformation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ScalarDistanceTransformation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename P, typename Sep, typename TI, typename TF, typename TE>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ScalarDistanceTransformation<P,Sep,TI,TF,TE> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/ScalarDistanceTransformation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ScalarDistanceTransformation_h
+
+#undef ScalarDistanceTransformation_RECURSES
+#endif // else defined(ScalarDistanceTransformation_RECURSES)
@@ -0,0 +1,128 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SeparableBlocks.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module SeparableBlocks.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SeparableBlocks_RECURSES)
+#error Recursive header files inclusion detected in SeparableBlocks.h
+#else // defined(SeparableBlocks_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SeparableBlocks_RECURSES
+
+#if !defined SeparableBlocks_h
+/** Prevents repeated inclusion of headers. */
+#define SeparableBlocks_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <cstddef>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SeparableBlocks
+  /**
+   * Description of template class 'SeparableBlocks' <p>
+   * \brief Aim: Indexing of the blocks of 1D problems of a step of a
+   * separable computation (VoronoiMap, PowerMap,
+   * ScalarDistanceTransformation).
+   *
+   * The step @a dim solves the 1D problems along the dimension @a
+   * dim starting in a box [@a lower, @a upper]. They are grouped by
+   * blocks of @a width consecutive spans along the dimension 0 (the
+   * rows along the dimension 0 being contiguous, @a width should be
+   * 1 for the step 0). A block index is decomposed as a mixed radix
+   * number, the dimension 0 (in units of @a width rows) being the
+   * fastest one.
+   *
+   * @tparam TPoint the type of points.
+   */
+  template <typename TPoint>
+  struct SeparableBlocks
+  {
+    typedef TPoint Point;
+    typedef typename Point::Dimension Dimension;
+    typedef typename Point::Coordinate Abscissa;
+
+    /**
+     * @param [in] dim the dimension to process.
+     * @param [in] width the block size along dimension 0.
+     * @param [in] lower lower bound of the box of starting points.
+     * @param [in] upper upper bound of the box of starting points.
+     * @return the number of blocks of 1D problems of the step @a dim.
+     */
+    static std::size_t count(const Dimension dim, const std::size_t width,
+                             const Point &lower, const Point &upper);
+
+    /**
+     * @param [in] aBlock a block index (in [0, count(dim, width,
+     * lower, upper)) ).
+     * @param [in] dim the dimension to process.
+     * @param [in] width the block size along dimension 0.
+     * @param [in] lower lower bound of the box of starting points.
+     * @param [in] upper upper bound of the box of starting points.
+     * @return the starting point of the first 1D span of the block
+     * (its coordinate @a dim is the one of @a lower).
+     */
+    static Point startingPoint(std::size_t aBlock,
+                               const Dimension dim,
+                               const std::size_t width,
+                               const Point &lower,
+                               const Point &upper);
+
+    /**
+     * @param [in] aStart the starting point of a block.
+     * @param [in] dim the dimension to process.
+     * @param [in] width the block size along dimension 0.
+     * @param [in] upper upper bound of the box of starting points.
+     * @return the number of 1D spans of the block (less than @a width
+     * for the last blocks along dimension 0).
+     */
+    static std::size_t spans(const Point &aStart,
+                             const Dimension dim,
+                             const std::size_t width,
+                             const Point &upper);
+
+  }; // end of struct SeparableBlocks
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/SeparableBlocks.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SeparableBlocks_h
+
+#undef SeparableBlocks_RECURSES
+#endif // else defined(SeparableBlocks_RECURSES)
@@ -0,0 +1,84 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SeparableMetricTraits.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module SeparableMetricTraits
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SeparableMetricTraits_RECURSES)
+#error Recursive header files inclusion detected in SeparableMetricTraits.h
+#else // defined(SeparableMetricTraits_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SeparableMetricTraits_RECURSES
+
+#if !defined SeparableMetricTraits_h
+/** Prevents repeated inclusion of headers. */
+#define SeparableMetricTraits_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConceptUtils.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SeparableMetricTraits
+  /**
+   * Description of template class 'SeparableMetricTraits' <p>
+   * \brief Aim: Traits of the models of CSeparableMetric used to
+   * select specialized 1D processes in the separable algorithms
+   * (e.g. VoronoiMap).
+   *
+   * - HasRowKernels: TagTrue if the metric provides the row kernels
+   *   lowerEnvelope() and cellEnds() working on packed arrays of
+   *   site abscissas and partial distances (see the @f$ l_2@f$
+   *   specialization of ExactPredicateLpSeparableMetric), TagFalse
+   *   otherwise.
+   * - RowValue: type of the partial distances of the row kernels
+   *   (meaningless if HasRowKernels is TagFalse).
+   *
+   * The default traits do not provide any row kernel.
+   *
+   * @tparam TMetric a model of CSeparableMetric.
+   */
+  template <typename TMetric>
+  struct SeparableMetricTraits
+  {
+    typedef TagFalse HasRowKernels;
+    typedef DGtal::int64_t RowValue;
+  }; // end of class SeparableMetricTraits
+
+} // namespace DGtal
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SeparableMetricTraits_h
+
+#undef SeparableMetricTraits_RECURSES
+#endif // else defined(SeparableMetricTraits_RECURSES)
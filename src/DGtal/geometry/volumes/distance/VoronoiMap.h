@@ -45,14 +45,20 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/CountedPtr.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/kernel/CPointPredicate.h"
+#include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/geometry/volumes/distance/CSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/SeparableMetricTraits.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/Executors.h"
+#include "DGtal/geometry/volumes/distance/SeparableBlocks.h"
+#include "DGtal/geometry/volumes/distance/VoronoiRows.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -86,10 +92,37 @@ namespace DGtal
    * l_2@f$ metric, the overall computation is in @f$ O(d.n^d)@f$,
    * which is optimal.
    *
-   * If DGtal has been built with OpenMP support (WITH_OPENMP flag set
-   * to "true"), the computation is done in parallel (multithreaded)
-   * in an optimal way: on @a p processors, expected runtime is in
-   * @f$ O(h.d.n^d / p)@f$.
+   * The independent 1D problems of each dimension are run by an
+   * executor (see Executors.h): SerialExecutor, OpenMPExecutor or
+   * ThreadPoolExecutor (process wide pool of threads, if C++11 thread
+   * support is available). By default, if DGtal has been built with
+   * OpenMP support (WITH_OPENMP flag set to "true"), the computation
+   * is done in parallel (multithreaded) in an optimal way: on @a p
+   * processors, expected runtime is in @f$ O(h.d.n^d / p)@f$. Each
+   * worker reuses its own buffers for all the 1D problems it solves,
+   * and the starting points of the 1D problems are computed from
+   * their indices.
+   *
+   * For dimensions @a dim > 0, the 1D problems along @a dim are
+   * processed by blocks of consecutive rows along dimension 0: the
+   * values of a block are gathered into a contiguous buffer (reading
+   * the image in dimension 0 order), each 1D problem is solved in this
+   * buffer and the results are scattered back to the image. Since the
+   * image containers store dimension 0 first, the memory is accessed
+   * by contiguous runs of the block size instead of one value per
+   * line (or slice) stride. The result does not depend on the block
+   * size (see class constructor).
+   *
+   * After a local modification of the point predicate (e.g. a few
+   * points added to or removed from a digital set used as predicate),
+   * the map can be updated with update() instead of being recomputed.
+   * The 1D problem of a line along @a dim only depends on the values
+   * of the step @a dim-1 on this line. Hence, the step 0 is solved on
+   * the rows containing modified points, then each step @a dim is
+   * solved on the lines along @a dim going through the points whose
+   * value changed at the step @a dim-1. To do so, the sites of the
+   * steps 0..d-2 are kept once update() has been called. The result
+   * is exactly the one of a complete computation.
    *
    * This class is a model of CConstImage.
    *
@@ -102,13 +135,16 @@ namespace DGtal
    * image container and the TSpace should match. Furthermore the
    * container value type must be TSpace::Vector. Lastly, the domain
    * of the container must be HyperRectDomain.
+   * @tparam TExecutor the executor running the 1D problems (default:
+   * DefaultExecutor, see Executors.h).
    */
   template < typename TSpace,
              typename TPointPredicate,
              typename TSeparableMetric,
              typename TImageContainer = 
              ImageContainerBySTLVector<HyperRectDomain<TSpace>,
-                                       typename TSpace::Vector>
+                                       typename TSpace::Vector>,
+             typename TExecutor = DefaultExecutor
              >
   class VoronoiMap
   {
@@ -163,9 +199,12 @@ namespace DGtal
     ///Definition of the image value type.
     typedef typename OutputImage::ConstRange  ConstRange;
 
+    ///Executor type
+    typedef TExecutor Executor;
+
     ///Self type
     typedef VoronoiMap<TSpace, TPointPredicate, 
-		       TSeparableMetric,TImageContainer> Self;
+		       TSeparableMetric,TImageContainer,TExecutor> Self;
     
 
     /**
@@ -185,10 +224,16 @@ namespace DGtal
      * Voronoi sites (false points).
      * 
      *@param aMetric a pointer to the separable metric instance.
+     *
+     * @param aBlockSize number of consecutive rows (along dimension
+     * 0) processed together for the steps @a dim > 0 (must be
+     * strictly positive, 1 corresponds to the row by row
+     * computation).
      */
     VoronoiMap(ConstAlias<Domain> aDomain,
                ConstAlias<PointPredicate> predicate,
-               ConstAlias<SeparableMetric> aMetric);
+               ConstAlias<SeparableMetric> aMetric,
+               const Size aBlockSize = 16);
 
     /**
      * Default destructor
@@ -244,6 +289,43 @@ namespace DGtal
       return myMetricPtr;
     }
 
+    /**
+     * Updates the Voronoi map after a modification of the point
+     * predicate values at some points. The predicate must already
+     * return the new values. The result is the same as the one of a
+     * complete computation with the new predicate.
+     *
+     * The first call recomputes the whole map and keeps the sites of
+     * the steps 0..d-2. The site of a point at the step @a k lies in
+     * the @a k+1 dimensional subspace of the first axes through this
+     * point, hence only its @a k+1 first coordinates are stored:
+     * d(d-1)/2 coordinates per point, i.e. half the memory of the map
+     * in 2D, as much in 3D and 1.5 times in 4D.
+     *
+     * The next calls solve the 1D problems of the rows containing
+     * modified points, then, for each dimension @a dim > 0, of the
+     * lines along @a dim going through the points whose site changed
+     * at the step @a dim-1. The cost is the number of these lines
+     * times their length: it depends on the extent of the changes of
+     * the sites, not on the domain size, and it is at most the one of
+     * a complete computation.
+     *
+     * @note maps copied with operator= share their images, an update
+     * of one of them also modifies the other ones.
+     *
+     * @param [in] addedPoints range of points added to the predicate
+     * set (predicate now true, i.e. sites removed).
+     * @param [in] removedPoints range of points removed from the
+     * predicate set (predicate now false, i.e. new sites).
+     *
+     * @tparam TAddedRange @tparam TRemovedRange any ranges of points
+     * (with begin() and end() methods returning const iterators on
+     * Point).
+     */
+    template <typename TAddedRange, typename TRemovedRange>
+    void update(const TAddedRange &addedPoints,
+                const TRemovedRange &removedPoints);
+
     /**
      * Self Display method.
      * 
@@ -253,6 +335,12 @@ namespace DGtal
    
     // ------------------- Private functions ------------------------
   private:    
+
+    ///Solver of the 1D problems
+    typedef VoronoiRows<SeparableMetric, Point> Rows;
+
+    ///Per worker buffers of the 1D problems
+    typedef typename Rows::LineBuffer LineBuffer;
     
     /**
      * Compute the Voronoi Map of a set of point sites using a
@@ -267,20 +355,129 @@ namespace DGtal
      *  Compute the other steps of the separable Voronoi map.
      * 
      * @param [in] dim the dimension to process
+     * @param [in,out] blocks per worker block buffers.
+     * @param [in,out] sites per worker site buffers.
      */    
-    void computeOtherSteps(const Dimension dim) const;
+    void computeOtherSteps(const Dimension dim,
+                           std::vector< std::vector<Value> > & blocks,
+                           std::vector<LineBuffer> & sites) const;
+
+    /**
+     * Stores the k+1 first coordinates of the sites of the map after
+     * the step @a k (see update).
+     *
+     * @param [in] k the step, in [0, d-2].
+     */
+    void savePartialMap(const Dimension k);
+
+    /**
+     * Solves the 1D problem of the line along @a dim starting at @a
+     * row during an update: its values are read from the sites of
+     * the step @a dim-1 (or from the predicate if @a dim is 0) and
+     * written to the sites of the step @a dim (or to the map if @a
+     * dim is d-1).
+     *
+     * @param [in] row starting point of the line.
+     * @param [in] dim dimension of the line.
+     * @param [in,out] values a buffer to store the line values.
+     * @param [in,out] Sites a buffer to store the sites of the line.
+     * @param [out] changed the starting points of the lines along @a
+     * dim+1 going through the points whose site changed are appended
+     * to this vector (if @a dim < d-1).
+     */
+    void updateLine(const Point &row,
+                    const Dimension dim,
+                    std::vector<Value> &values,
+                    LineBuffer &Sites,
+                    std::vector<Point> &changed) const;
+
     /** 
-     * Given  a voronoi map valid at dimension @a dim-1, this method
+     * Given a voronoi map valid at dimension @a dim-1, this method
      * updates the map to make it consistent at dimension @a dim along
-     * the 1D span starting at @a row along the dimension @a
-     * dim.
+     * the @a width 1D spans starting at @a row, @a row + e_0, ...,
+     * @a row + (@a width-1).e_0 along the dimension @a dim.
+     *
+     * The block is gathered into a contiguous buffer, each 1D span
+     * is processed by computeOtherStep1D and the buffer is scattered
+     * back to the map.
+     * 
+     * @param [in] row starting point of the first 1D span.
+     * @param [in] width number of 1D spans of the block (should be 1
+     * if @a dim is 0).
+     * @param [in] dim dimension of the update.
+     * @param [in,out] block a buffer to store the block values.
+     * @param [in,out] Sites a buffer to store the sites of a span.
+     */
+    void computeOtherStepBlock (const Point &row,
+                                const Size width,
+                                const Size dim,
+                                std::vector<Value> &block,
+                                LineBuffer &Sites) const;
+
+    /** 
+     * Given  a voronoi map valid at dimension @a dim-1, this method
+     * updates the map values of the 1D span starting at @a row along
+     * the dimension @a dim. The values of the span are read from and
+     * written to the contiguous buffer @a values (see VoronoiRows).
      * 
      * @param [in] row starting point of the 1D process.
      * @param [in] dim dimension of the update.
+     * @param [in,out] values the span values (
+     * myUpperBoundCopy[dim]-myLowerBoundCopy[dim]+1 elements).
+     * @param [in,out] Sites a buffer to store the sites of the span.
      */
     void computeOtherStep1D (const Point &row, 
-			     const Size dim) const;
+			     const Size dim,
+                             Value *values,
+                             LineBuffer &Sites) const;
     
+    /**
+     * Task functor solving the 1D problems of the block of a given
+     * index (see computeOtherSteps), with the buffers of the worker
+     * running it.
+     */
+    struct BlockTask
+    {
+      const Self * voronoiMap;
+      Dimension dim;
+      Size width;
+      std::vector< std::vector<Value> > * blocks;
+      std::vector<LineBuffer> * sites;
+
+      void operator()(const std::size_t worker, const std::size_t aBlock) const
+      {
+        const Point & lower = voronoiMap->myLowerBoundCopy;
+        const Point & upper = voronoiMap->myUpperBoundCopy;
+        const Point start = SeparableBlocks<Point>::startingPoint( aBlock, dim, width,
+                                                                   lower, upper );
+        const Size w = SeparableBlocks<Point>::spans( start, dim, width, upper );
+        voronoiMap->computeOtherStepBlock( start, w, dim,
+                                           (*blocks)[ worker ], (*sites)[ worker ] );
+      }
+    };
+    friend struct BlockTask;
+
+    /**
+     * Task functor solving the 1D problem of the i-th line of an
+     * update step (see updateLine).
+     */
+    struct LineTask
+    {
+      const Self * voronoiMap;
+      Dimension dim;
+      const std::vector<Point> * lines;
+      std::vector< std::vector<Value> > * blocks;
+      std::vector<LineBuffer> * sites;
+      std::vector< std::vector<Point> > * changed;
+
+      void operator()(const std::size_t worker, const std::size_t i) const
+      {
+        voronoiMap->updateLine( (*lines)[ i ], dim, (*blocks)[ worker ],
+                                (*sites)[ worker ], (*changed)[ worker ] );
+      }
+    };
+    friend struct LineTask;
+
     // ------------------- protected methods ------------------------
   protected:
 
@@ -309,6 +506,12 @@ namespace DGtal
     ///Value to act as a +infinity value
     Point myInfinity;
 
+    ///Number of rows processed together for dimensions > 0
+    Size myBlockSize;
+
+    ///Executor running the 1D problems
+    Executor myExecutor;
+
   protected:
 
     ///Pointer to the separable metric instance
@@ -317,6 +520,11 @@ namespace DGtal
     ///Voronoi map image
     CountedPtr<OutputImage> myImagePtr;
 
+    ///For each step k in 0..d-2, the k+1 first coordinates of the
+    ///sites after this step, in the linearized order of the domain
+    ///(only kept for update())
+    CountedPtr< std::vector< std::vector<Abscissa> > > myPartialMapsPtr;
+
   }; // end of class VoronoiMap
 
   /**
@@ -326,9 +534,9 @@ namespace DGtal
    * @return the output stream after the writing.
    */
   template <typename S, typename P,
-            typename Sep, typename TI>
+            typename Sep, typename TI, typename TE>
   std::ostream&
-  operator<< ( std::ostream & out, const VoronoiMap<S,P,Sep,TI> & object );
+  operator<< ( std::ostream & out, const VoronoiMap<S,P,Sep,TI,TE> & object );
 
 
 } // namespace DGtal
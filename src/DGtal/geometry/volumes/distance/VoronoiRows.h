@@ -0,0 +1,166 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file VoronoiRows.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module VoronoiRows.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(VoronoiRows_RECURSES)
+#error Recursive header files inclusion detected in VoronoiRows.h
+#else // defined(VoronoiRows_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define VoronoiRows_RECURSES
+
+#if !defined VoronoiRows_h
+/** Prevents repeated inclusion of headers. */
+#define VoronoiRows_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/geometry/volumes/distance/SeparableMetricTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class VoronoiRows
+  /**
+   * Description of template class 'VoronoiRows' <p>
+   * \brief Aim: Solver of the 1D problems of the separable Voronoi
+   * map steps, shared by VoronoiMap and OutOfCoreVoronoiMap.
+   *
+   * Given a Voronoi map valid at dimension @a dim-1, the values of a
+   * 1D span along @a dim (the closest sites, or an infinity point if
+   * no site) are replaced by the ones of the step @a dim. The span
+   * values are read from and written to a contiguous buffer.
+   *
+   * The metrics with row kernels (see SeparableMetricTraits) use
+   * them: the sites of the span are packed into arrays of abscissas
+   * and partial distances, the lower envelope and the cell ends are
+   * computed by the metric and the cells are filled span by span.
+   * The other metrics call the hiddenBy and closest predicates for
+   * each site.
+   *
+   * @tparam TSeparableMetric a model of CSeparableMetric.
+   * @tparam TPoint the type of points.
+   */
+  template <typename TSeparableMetric, typename TPoint>
+  struct VoronoiRows
+  {
+    typedef TSeparableMetric SeparableMetric;
+    typedef TPoint Point;
+    typedef typename Point::Dimension Dimension;
+    typedef typename Point::Coordinate Abscissa;
+
+    ///Type of the partial distances of the row kernels
+    typedef typename SeparableMetricTraits<SeparableMetric>::RowValue RowValue;
+
+    /**
+     * Per worker buffers of the 1D problems: the sites of the lower
+     * envelope and, for the metrics with row kernels, the packed
+     * abscissas, partial distances, indices and cell ends of the
+     * sites of a span.
+     */
+    struct LineBuffer
+    {
+      std::vector<Point> sites;
+      std::vector<Abscissa> abscissas;
+      std::vector<RowValue> heights;
+      std::vector<std::size_t> indices;
+      std::vector<Abscissa> ends;
+    };
+
+    /**
+     * Solves the 1D problem of the span starting at @a startingPoint along @a
+     * dim.
+     *
+     * @param [in] aMetric the separable metric.
+     * @param [in] startingPoint starting point of the span.
+     * @param [in] dim dimension of the step.
+     * @param [in] aLower first abscissa of the span.
+     * @param [in] aUpper last abscissa of the span.
+     * @param [in] anInfinity the value of the points without site.
+     * @param [in,out] values the span values (@a aUpper - @a aLower
+     * + 1 elements).
+     * @param [in,out] aBuffer the buffers of the worker.
+     */
+    static void solve(const SeparableMetric &aMetric,
+                      const Point &startingPoint,
+                      const Dimension dim,
+                      const Abscissa aLower,
+                      const Abscissa aUpper,
+                      const Point &anInfinity,
+                      Point *values,
+                      LineBuffer &aBuffer);
+
+  private:
+
+    /**
+     * Generic 1D process (see solve), calling the hiddenBy and
+     * closest predicates of the metric for each site.
+     */
+    static void solve(const SeparableMetric &aMetric,
+                      const Point &startingPoint,
+                      const Dimension dim,
+                      const Abscissa aLower,
+                      const Abscissa aUpper,
+                      const Point &anInfinity,
+                      Point *values,
+                      LineBuffer &aBuffer,
+                      TagFalse);
+
+    /**
+     * 1D process (see solve) with the row kernels of the metric.
+     */
+    static void solve(const SeparableMetric &aMetric,
+                      const Point &startingPoint,
+                      const Dimension dim,
+                      const Abscissa aLower,
+                      const Abscissa aUpper,
+                      const Point &anInfinity,
+                      Point *values,
+                      LineBuffer &aBuffer,
+                      TagTrue);
+
+  }; // end of struct VoronoiRows
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/volumes/distance/VoronoiRows.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined VoronoiRows_h
+
+#undef VoronoiRows_RECURSES
+#endif // else defined(VoronoiRows_RECURSES)
@@ -90,7 +90,8 @@ namespace DGtal
 ### Invariants
 
 ### Models
-  ImageContainerBySTLVector, ImageContainerBySTLMap, ImageContainerByITKImage, ImageContainerByHashTree
+  ImageContainerBySTLVector, ImageContainerBySTLMap, ImageContainerByITKImage, ImageContainerByHashTree,
+  ImageContainerByBlockGrid, ImageContainerByMappedFile, ImageContainerByCompressedTiles
  
 
 ### Notes
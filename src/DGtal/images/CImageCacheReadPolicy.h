@@ -75,12 +75,13 @@ Description of \b concept '\b CImageCacheReadPolicy' <p>
 |---------------------|-------------------------|----------------------|-------------------|--------------------------------------|------------------------------------------------------|----------------|------------|
 | Get page            | x.getPage(p)            | p of type Point      | ImageContainer    | p should be in a domain of the cache | get the alias on the image that contains the point p |                |            |
 | Get page to detach  | x.getPageToDetach()     |                      | ImageContainer    |                                      | get the alias on the image that we have to detach    |                |            |
+| Get page to clear   | x.getPageToClear()      |                      | ImageContainer    |                                      | get (and remove from the cache) the alias on an image of the cache, NULL if the cache is empty |                |            |
 | Update cache        | x.updateCache(d)        | d of type Domain     |                   |                                      | update the cache with a new Domain d                 |                |            |
 
 ### Invariants
 
 ### Models
-ImageCacheReadPolicyLAST, ImageCacheReadPolicyFIFO
+ImageCacheReadPolicyLAST, ImageCacheReadPolicyFIFO, ImageCacheReadPolicyLRU, ImageCacheReadPolicyCLOCK
 
 ### Notes
 
@@ -98,6 +99,7 @@ public:
     {
         ConceptUtils::sameType( myIC, myT.getPage(myPoint) );
         ConceptUtils::sameType( myIC, myT.getPageToDetach() );
+        ConceptUtils::sameType( myIC, myT.getPageToClear() );
         myT.updateCache(myDomain);
 
         // check const methods.
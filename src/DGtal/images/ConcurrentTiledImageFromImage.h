@@ -0,0 +1,413 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ConcurrentTiledImageFromImage.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ConcurrentTiledImageFromImage.cpp
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testConcurrentTiledImageFromImage.cpp
+ */
+
+#if defined(ConcurrentTiledImageFromImage_RECURSES)
+#error Recursive header files inclusion detected in ConcurrentTiledImageFromImage.h
+#else // defined(ConcurrentTiledImageFromImage_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ConcurrentTiledImageFromImage_RECURSES
+
+#if !defined ConcurrentTiledImageFromImage_h
+/** Prevents repeated inclusion of headers. */
+#define ConcurrentTiledImageFromImage_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <deque>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConceptUtils.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/base/Alias.h"
+
+#include "DGtal/images/ImageFactoryFromImage.h"
+
+#ifdef CPP11_THREAD
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#endif
+//////////////////////////////////////////////////////////////////////////////
+
+#ifdef CPP11_THREAD
+namespace DGtal
+{
+/////////////////////////////////////////////////////////////////////////////
+// Template class ConcurrentTiledImageFromImage
+/**
+ * Description of template class 'ConcurrentTiledImageFromImage' <p>
+ * \brief Aim: implements a tiled image from a "bigger/original" one,
+ * which may be shared between threads, with an optional background
+ * prefetching of the tiles.
+ *
+ * The tiling is the one of TiledImageFromImage: @a N tiles per
+ * dimension, of size (extent + N - 1) / N, the last tile along a
+ * dimension being cropped to the domain. The tiles are requested
+ * from the image factory on demand and written back (write-back
+ * policy) when they leave the cache, when flush() is called and at
+ * the destruction of the tiled image.
+ *
+ * The cache is split into shards, the tile of index @a t belonging to
+ * the shard t % nbShards. Each shard has its own mutex and its own LRU
+ * list of pages, so that threads working on different tiles seldom
+ * wait for each other. The image factory is called without holding
+ * the shard lock (except for the write-back of the evicted pages),
+ * so that a slow requestImage() only blocks the threads waiting for
+ * that tile.
+ *
+ * When a prefetch distance @a d > 0 is given, a background thread
+ * loads the @a d tiles which follow, in the declared traversal order,
+ * each tile which is loaded on a miss or accessed for the first time
+ * after being prefetched. The orders are:
+ * - Lexicographic: the tiles in the order of the domain iteration
+ *   (first coordinate varying the fastest),
+ * - Slab: the same order, the whole next slab of tiles (orthogonal to
+ *   the last axis) being prefetched when a slab is entered
+ *   (@a d is then ignored),
+ * - Morton: the tiles in the Z-order of their indices.
+ * The cache should hold more than @a d tiles per shard, otherwise the
+ * prefetched tiles evict each other.
+ *
+ * The factory must support concurrent calls to requestImage() and
+ * flushImage() on distinct tiles (this is the case of
+ * ImageFactoryFromImage when the underlying image supports
+ * concurrent reads and concurrent writes at distinct points, like
+ * ImageContainerBySTLVector). An exception thrown by requestImage()
+ * (e.g. std::bad_alloc) goes to the thread which accesses the tile;
+ * the tile stays unloaded, and the next access requests it again.
+ *
+ * This class requires C++11 threads (CPP11_THREAD).
+ *
+ * @tparam TImageContainer an image container type (model of CImage).
+ * @tparam TImageFactoryFromImage an image factory type (model of CImageFactory).
+ *
+ * @see TiledImageFromImage
+ */
+template <typename TImageContainer, typename TImageFactoryFromImage>
+class ConcurrentTiledImageFromImage
+{
+
+    // ----------------------- Types ------------------------------
+
+public:
+    typedef ConcurrentTiledImageFromImage<TImageContainer, TImageFactoryFromImage> Self;
+
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( CImage<TImageContainer> ));
+
+    ///Types copied from the container
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Point Point;
+    typedef typename TImageContainer::Value Value;
+
+    typedef TImageFactoryFromImage ImageFactoryFromImage;
+    typedef typename ImageFactoryFromImage::OutputImage OutputImage;
+
+    /// Traversal orders of the prefetcher
+    enum TraversalOrder { Lexicographic, Slab, Morton };
+
+    // ----------------------- Standard services ------------------------------
+
+public:
+
+    /**
+     * Constructor.
+     * @param anImage alias on the underlying image container.
+     * @param anImageFactoryFromImage alias on the image factory (see ImageFactoryFromImage).
+     * @param N how many tiles we want for each dimension.
+     * @param aCacheSizeMax the maximal number of tiles in the cache
+     * (at least one per shard).
+     * @param anOrder the traversal order followed by the prefetcher.
+     * @param aPrefetchDistance the number of tiles prefetched ahead
+     * (0 for no prefetching thread).
+     * @param aNbShards the number of shards of the cache.
+     */
+    ConcurrentTiledImageFromImage(Alias<ImageContainer> anImage,
+                                  Alias<ImageFactoryFromImage> anImageFactoryFromImage,
+                                  typename Domain::Integer N,
+                                  unsigned int aCacheSizeMax = 64,
+                                  TraversalOrder anOrder = Lexicographic,
+                                  unsigned int aPrefetchDistance = 0,
+                                  unsigned int aNbShards = 16);
+
+    /**
+     * Destructor.
+     * Stops the prefetcher, then flushes and detaches all the tiles.
+     */
+    ~ConcurrentTiledImageFromImage();
+
+    // ----------------------- Interface --------------------------------------
+public:
+
+    /**
+     * Returns a reference to the underlying image domain.
+     *
+     * @return a reference to the domain.
+     */
+    const Domain & domain() const
+    {
+      return myImagePtr->domain();
+    }
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const
+    {
+        return (myImagePtr->isValid());
+    }
+
+    /**
+     * Get the domain of the tile containing aPoint.
+     *
+     * @param aPoint the point.
+     * @return the domain containing aPoint.
+     */
+    Domain findSubDomain(const Point & aPoint) const;
+
+    /**
+     * Get the value of the image at aPoint, loading its tile if
+     * needed. Thread-safe.
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()(const Point & aPoint) const;
+
+    /**
+     * Set a value at aPoint, loading its tile if needed. Thread-safe.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue(const Point &aPoint, const Value &aValue);
+
+    /**
+     * Flush the cache: the modified tiles are written to the
+     * underlying image (they stay in the cache). Thread-safe.
+     */
+    void flush();
+
+    /**
+     * @return the number of accesses to a tile of the cache.
+     */
+    DGtal::uint64_t nbHits() const;
+
+    /**
+     * @return the number of accesses which had to load their tile
+     * (or to wait for its loading by another thread).
+     */
+    DGtal::uint64_t nbMisses() const;
+
+    /**
+     * @return the number of tiles loaded by the prefetcher.
+     */
+    DGtal::uint64_t nbPrefetched() const;
+
+    // ------------------------- Private Datas --------------------------------
+private:
+
+    /// State of a tile (protected by the mutex of its shard)
+    struct Tile
+    {
+      OutputImage * page;
+      bool loading;
+      bool dirty;
+      bool prefetched;
+      std::size_t previous;
+      std::size_t next;
+    };
+
+    /// A shard of the cache: its tiles are linked in LRU order
+    struct Shard
+    {
+      std::mutex mutex;
+      std::condition_variable loaded;
+      std::size_t first;
+      std::size_t last;
+      unsigned int nbPages;
+      DGtal::uint64_t nbHits;
+      DGtal::uint64_t nbMisses;
+    };
+
+    /// End of the LRU lists
+    static const std::size_t NONE = (std::size_t) -1;
+
+    /// Alias on the image container
+    ImageContainer * myImagePtr;
+
+    /// ImageFactory pointer
+    ImageFactoryFromImage * myImageFactoryFromImage;
+
+    /// Width of a tile (for each dimension)
+    Point mySize;
+
+    /// Number of tiles for each dimension (may be less than N)
+    Point myNbTiles;
+
+    /// Maximal number of pages per shard
+    unsigned int myShardSizeMax;
+
+    /// Tiles of the image
+    mutable std::vector<Tile> myTiles;
+
+    /// Shards of the cache
+    mutable std::vector< std::unique_ptr<Shard> > myShards;
+
+    /// Tiles in traversal order, and rank of each tile in this order
+    std::vector<std::size_t> myOrder;
+    std::vector<std::size_t> myRank;
+
+    /// Traversal order
+    TraversalOrder myTraversalOrder;
+
+    /// Number of tiles prefetched ahead (0 for no prefetcher)
+    unsigned int myPrefetchDistance;
+
+    /// Prefetcher thread, its queue (of ranks) and its state
+    std::thread myPrefetcher;
+    mutable std::mutex myPrefetchMutex;
+    mutable std::condition_variable myPrefetchWakeUp;
+    mutable std::deque<std::size_t> myPrefetchQueue;
+    bool myStop;
+    mutable DGtal::uint64_t myNbPrefetched;
+
+    // ------------------------- Internals ------------------------------------
+private:
+
+    /**
+     * Copy constructor and assignment (forbidden).
+     */
+    ConcurrentTiledImageFromImage( const ConcurrentTiledImageFromImage & other );
+    ConcurrentTiledImageFromImage & operator= ( const ConcurrentTiledImageFromImage & other );
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the index of the tile containing aPoint.
+     */
+    std::size_t tileIndex(const Point & aPoint) const;
+
+    /**
+     * @param t a tile index.
+     * @return the domain of the tile @a t.
+     */
+    Domain tileDomain(const std::size_t t) const;
+
+    /**
+     * Computes the order of the tiles (myOrder and myRank).
+     */
+    void computeOrder();
+
+    /**
+     * Returns the page of the tile @a t, loading it if needed, and
+     * moves it to the front of the LRU list of its shard.
+     *
+     * @param t a tile index.
+     * @param aLock the lock on the mutex of the shard of @a t.
+     * @return the page of the tile.
+     */
+    OutputImage * acquire(const std::size_t t, std::unique_lock<std::mutex> & aLock) const;
+
+    /**
+     * Loads the tile @a t (the lock is released while the factory
+     * builds the page) and evicts the least recently used pages of
+     * its shard.
+     *
+     * If the factory throws an exception, the tile is left unloaded
+     * (the threads waiting for it are woken up and load it again) and
+     * the exception is thrown again, with @a aLock locked.
+     *
+     * @param t a tile index, neither loaded nor being loaded.
+     * @param aLock the lock on the mutex of the shard of @a t.
+     * @param isPrefetched 'true' if the prefetcher loads the tile.
+     */
+    void load(const std::size_t t, std::unique_lock<std::mutex> & aLock,
+              const bool isPrefetched) const;
+
+    /**
+     * Enqueues the tiles following @a t for the prefetcher.
+     * @param t a tile index.
+     */
+    void prefetchAfter(const std::size_t t) const;
+
+    /**
+     * Main loop of the prefetcher thread.
+     */
+    void prefetcherLoop();
+
+    /**
+     * Removes the tile @a t from the LRU list of @a aShard.
+     */
+    void unlink(Shard & aShard, const std::size_t t) const;
+
+    /**
+     * Inserts the tile @a t at the front of the LRU list of @a aShard.
+     */
+    void pushFront(Shard & aShard, const std::size_t t) const;
+
+}; // end of class ConcurrentTiledImageFromImage
+
+
+/**
+ * Overloads 'operator<<' for displaying objects of class 'ConcurrentTiledImageFromImage'.
+ * @param out the output stream where the object is written.
+ * @param object the object of class 'ConcurrentTiledImageFromImage' to write.
+ * @return the output stream after the writing.
+ */
+template <typename TImageContainer, typename TImageFactoryFromImage>
+std::ostream&
+operator<< ( std::ostream & out, const ConcurrentTiledImageFromImage<TImageContainer, TImageFactoryFromImage> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ConcurrentTiledImageFromImage.ih"
+#endif // CPP11_THREAD
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ConcurrentTiledImageFromImage_h
+
+#undef ConcurrentTiledImageFromImage_RECURSES
+#endif // else defined(ConcurrentTiledImageFromImage_RECURSES)
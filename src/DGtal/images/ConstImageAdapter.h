@@ -245,6 +245,15 @@ public:
         return myImagePtr;
     }
 
+    /**
+     * Returns the functor applied to the values of the image container.
+     * @return a const reference on the value functor.
+     */
+    const TFunctorV & getValueFunctor() const
+    {
+        return *myFV;
+    }
+
     // ------------------------- Protected Datas ------------------------------
 private:
     /**
@@ -0,0 +1,509 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HashTreeStorages.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module HashTreeStorages.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(HashTreeStorages_RECURSES)
+#error Recursive header files inclusion detected in HashTreeStorages.h
+#else // defined(HashTreeStorages_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HashTreeStorages_RECURSES
+
+#if !defined HashTreeStorages_h
+/** Prevents repeated inclusion of headers. */
+#define HashTreeStorages_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace experimental
+  {
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class LinkedHashTreeStorage
+  /**
+   * Description of template class 'LinkedHashTreeStorage' <p>
+   * @brief Aim: Node storage of ImageContainerByHashTree as an array
+   * of @f$ 2^K@f$ linked lists of separately allocated nodes, the
+   * bucket of a key being given by its K lowest bits.
+   *
+   * This is the historical layout of the hash tree. The array is
+   * never resized, so that the collision chains grow with the number
+   * of nodes.
+   *
+   * The storages of ImageContainerByHashTree provide the types Node
+   * (with getKey() and getObject()) and Iterator, and the methods
+   * find(), insert(), remove(), size() and the statistics methods
+   * used by the container (nbBuckets(), nbNodes(), nbEmptyBuckets(),
+   * averageCollisions(), maxCollisions(), memory()).
+   *
+   * @tparam THashKey type of the Morton keys.
+   * @tparam TValue type of the values.
+   *
+   * @see OpenAddressingHashTreeStorage, ImageContainerByHashTree
+   */
+  template <typename THashKey, typename TValue>
+  class LinkedHashTreeStorage
+  {
+  public:
+    typedef THashKey HashKey;
+    typedef TValue Value;
+
+    /**
+     * A node of a linked list: a pair (key, value).
+     */
+    class Node
+    {
+    public:
+      Node(Value aValue, HashKey key, Node* next)
+        : myKey(key), myNext(next), myData(aValue)
+      {}
+
+      inline Node* getNext() const
+      {
+        return myNext;
+      }
+      inline void setNext(Node* next)
+      {
+        myNext = next;
+      }
+      inline HashKey getKey() const
+      {
+        return myKey;
+      }
+      inline Value& getObject()
+      {
+        return myData;
+      }
+    protected:
+      HashKey myKey;
+      Node* myNext;
+      Value myData;
+    };
+
+    /**
+     * Iterator on the nodes, bucket by bucket.
+     */
+    class Iterator
+    {
+    public:
+      Iterator(Node** data, unsigned int position, unsigned int arraySize);
+      bool isAtEnd() const
+      {
+        return myCurrentCell >= myArraySize;
+      }
+      Value& operator*()
+      {
+        return myNode->getObject();
+      }
+      bool operator ++ ()
+      {
+        return next();
+      }
+      bool operator == (const Iterator& it) const
+      {
+        if (isAtEnd() && it.isAtEnd())
+          return true;
+        else
+          return (myNode == it.myNode);
+      }
+      bool operator != (const Iterator& it) const
+      {
+        return !( *this == it );
+      }
+      inline HashKey getKey() const
+      {
+        return myNode->getKey();
+      }
+      bool next();
+    protected:
+      Node* myNode;
+      unsigned int myCurrentCell;
+      unsigned int myArraySize;
+      Node** myContainerData;
+    };
+
+    /**
+     * Constructor.
+     * @param keySize the number of bits K of the bucket index.
+     */
+    LinkedHashTreeStorage( const unsigned int keySize );
+
+    /**
+     * Copy constructor (deep copy).
+     * @param other the object to clone.
+     */
+    LinkedHashTreeStorage( const LinkedHashTreeStorage & other );
+
+    /**
+     * Assignment (deep copy).
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    LinkedHashTreeStorage & operator=( const LinkedHashTreeStorage & other );
+
+    /**
+     * Destructor.
+     */
+    ~LinkedHashTreeStorage();
+
+    /**
+     * @param key a key.
+     * @return a pointer to the node of key @a key, 0 if none.
+     */
+    inline Node* find( const HashKey key ) const
+    {
+      Node* iter = myData[ key & myMask ];
+      while ( iter != 0 )
+        {
+          if ( iter->getKey() == key )
+            return iter;
+          iter = iter->getNext();
+        }
+      return 0;
+    }
+
+    /**
+     * Inserts a node, the key being not in the storage.
+     * @param key a key.
+     * @param aValue its value.
+     * @return a pointer to the new node.
+     */
+    Node* insert( const HashKey key, const Value aValue );
+
+    /**
+     * Removes the node of key @a key.
+     * @param key a key.
+     * @return false if there is no such node.
+     */
+    bool remove( const HashKey key );
+
+    /// @return the number of nodes.
+    std::size_t size() const;
+
+    /// @return the number of buckets.
+    unsigned int nbBuckets() const;
+
+    /// @return the number of nodes of the bucket @a aBucket.
+    unsigned int nbNodes( const unsigned int aBucket ) const;
+
+    /// @return the number of empty buckets.
+    unsigned int nbEmptyBuckets() const;
+
+    /// @return the average length minus one of the non empty lists.
+    double averageCollisions() const;
+
+    /// @return the maximal length minus one of the lists.
+    unsigned int maxCollisions() const;
+
+    /// @return the memory used by the buckets and the nodes (bytes).
+    std::size_t memory() const;
+
+    /**
+     * Prints the buckets and their nodes.
+     * @param out output stream.
+     * @param nbBits number of bits of the displayed keys (0 for none).
+     */
+    void printInternalState( std::ostream & out, const unsigned int nbBits ) const;
+
+    Iterator begin() const
+    {
+      return Iterator( myData, 0, myArraySize );
+    }
+    Iterator end() const
+    {
+      return Iterator( myData, myArraySize, myArraySize );
+    }
+
+  private:
+    void clear();
+    void copy( const LinkedHashTreeStorage & other );
+
+    /// Number of bits of the bucket index
+    unsigned int myKeySize;
+    /// Number of buckets
+    unsigned int myArraySize;
+    /// Mask giving the bucket of a key
+    HashKey myMask;
+    /// Number of nodes
+    std::size_t mySize;
+    /// The array of linked lists
+    Node** myData;
+  }; // end of class LinkedHashTreeStorage
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class OpenAddressingHashTreeStorage
+  /**
+   * Description of template class 'OpenAddressingHashTreeStorage' <p>
+   * @brief Aim: Node storage of ImageContainerByHashTree as a flat
+   * open addressing table (linear probing with the Robin Hood
+   * policy), the key 0 (never a valid key) marking the empty slots.
+   *
+   * The home slot of a key is given by a multiplicative hash of the
+   * whole Morton key, so that the sibling keys do not fill
+   * consecutive slots. During an insertion, a node takes the slot of
+   * any node closer to its home slot, which bounds the probe lengths.
+   * Removals shift the following nodes backward, without tombstones.
+   * The table doubles when it is 7/8 full.
+   *
+   * Each slot has a 16 bits tag in a separate compact array: its
+   * distance to the home slot of its node plus one (0 for an empty
+   * slot) and 8 more bits of the hash. A search for a missing key
+   * (frequent in get() and setValue(), which look for the leaf among
+   * the ancestors of a key) stops at the first slot whose distance
+   * is smaller than the probe length, and the keys are only compared
+   * when the hash bits match, so that most probes only read the tag
+   * array.
+   *
+   * A node is the pair (key, value) in the slot: there is no pointer
+   * nor allocation per node. Pointers to nodes are invalidated by
+   * insertions and removals.
+   *
+   * @tparam THashKey type of the Morton keys (unsigned integer).
+   * @tparam TValue type of the values.
+   *
+   * @see LinkedHashTreeStorage, ImageContainerByHashTree
+   */
+  template <typename THashKey, typename TValue>
+  class OpenAddressingHashTreeStorage
+  {
+  public:
+    typedef THashKey HashKey;
+    typedef TValue Value;
+
+    /**
+     * A slot of the table: a pair (key, value), the key 0 marking an
+     * empty slot.
+     */
+    class Node
+    {
+    public:
+      Node(): myKey(0), myData()
+      {}
+      Node(Value aValue, HashKey key): myKey(key), myData(aValue)
+      {}
+
+      inline HashKey getKey() const
+      {
+        return myKey;
+      }
+      inline Value& getObject()
+      {
+        return myData;
+      }
+    protected:
+      HashKey myKey;
+      Value myData;
+    };
+
+    /**
+     * Iterator on the nodes, in the order of the slots.
+     */
+    class Iterator
+    {
+    public:
+      Iterator(Node* data, unsigned int position, unsigned int arraySize);
+      bool isAtEnd() const
+      {
+        return myCurrentCell >= myArraySize;
+      }
+      Value& operator*()
+      {
+        return myContainerData[ myCurrentCell ].getObject();
+      }
+      bool operator ++ ()
+      {
+        return next();
+      }
+      bool operator == (const Iterator& it) const
+      {
+        if (isAtEnd() && it.isAtEnd())
+          return true;
+        else
+          return (myCurrentCell == it.myCurrentCell);
+      }
+      bool operator != (const Iterator& it) const
+      {
+        return !( *this == it );
+      }
+      inline HashKey getKey() const
+      {
+        return myContainerData[ myCurrentCell ].getKey();
+      }
+      bool next();
+    protected:
+      unsigned int myCurrentCell;
+      unsigned int myArraySize;
+      Node* myContainerData;
+    };
+
+    /**
+     * Constructor.
+     * @param keySize the number of bits K of the initial number of
+     * slots (at least 1).
+     */
+    OpenAddressingHashTreeStorage( const unsigned int keySize );
+
+    /**
+     * @param key a key.
+     * @return a pointer to the node of key @a key, 0 if none.
+     */
+    inline Node* find( const HashKey key ) const
+    {
+      const DGtal::uint64_t h = hash( key );
+      unsigned int i = home( h );
+      Tag probe = firstProbe( h );
+      for ( ;; )
+        {
+          const Tag t = myTags[ i ];
+          if ( t == probe )
+            {
+              if ( mySlots[ i ].getKey() == key )
+                return const_cast<Node*>( &mySlots[ i ] );
+            }
+          else if ( t < ( probe & DistanceMask ) )
+            return 0;
+          i = ( i + 1 ) & myMask;
+          probe += DistanceOne;
+        }
+    }
+
+    /**
+     * Inserts a node, the key being not in the storage.
+     * @param key a key.
+     * @param aValue its value.
+     * @return a pointer to the new node.
+     */
+    Node* insert( const HashKey key, const Value aValue );
+
+    /**
+     * Removes the node of key @a key.
+     * @param key a key.
+     * @return false if there is no such node.
+     */
+    bool remove( const HashKey key );
+
+    /// @return the number of nodes.
+    std::size_t size() const;
+
+    /// @return the number of slots.
+    unsigned int nbBuckets() const;
+
+    /// @return the number of nodes in the slot @a aBucket (0 or 1).
+    unsigned int nbNodes( const unsigned int aBucket ) const;
+
+    /// @return the number of empty slots.
+    unsigned int nbEmptyBuckets() const;
+
+    /// @return the average distance of the nodes to their home slot.
+    double averageCollisions() const;
+
+    /// @return the maximal distance of a node to its home slot.
+    unsigned int maxCollisions() const;
+
+    /// @return the memory used by the table (bytes).
+    std::size_t memory() const;
+
+    /**
+     * Prints the slots.
+     * @param out output stream.
+     * @param nbBits number of bits of the displayed keys (0 for none).
+     */
+    void printInternalState( std::ostream & out, const unsigned int nbBits ) const;
+
+    Iterator begin() const
+    {
+      return Iterator( const_cast<Node*>( &mySlots[0] ), 0, myArraySize );
+    }
+    Iterator end() const
+    {
+      return Iterator( const_cast<Node*>( &mySlots[0] ), myArraySize, myArraySize );
+    }
+
+  private:
+    /// Tag of a slot: (distance to the home slot + 1) * 256 + 8 hash bits
+    typedef DGtal::uint16_t Tag;
+    static const Tag DistanceOne = 256;
+    static const Tag DistanceMask = 0xFF00;
+
+    /// @return the multiplicative hash of @a key.
+    static inline DGtal::uint64_t hash( const HashKey key )
+    {
+      return (DGtal::uint64_t) key * 0x9E3779B97F4A7C15ULL;
+    }
+
+    /// @return the home slot of the hash value @a h.
+    inline unsigned int home( const DGtal::uint64_t h ) const
+    {
+      return (unsigned int) ( h >> ( 64 - myKeySize ) );
+    }
+
+    /// @return the tag of the hash value @a h in its home slot.
+    inline Tag firstProbe( const DGtal::uint64_t h ) const
+    {
+      return (Tag) ( DistanceOne | ( ( h >> ( 56 - myKeySize ) ) & 0xFF ) );
+    }
+
+    /// Doubles the number of slots.
+    void grow();
+
+    /// Number of bits of the number of slots
+    unsigned int myKeySize;
+    /// Number of slots
+    unsigned int myArraySize;
+    /// myArraySize - 1
+    unsigned int myMask;
+    /// Number of nodes
+    std::size_t mySize;
+    /// The slots
+    std::vector<Node> mySlots;
+    /// The tags of the slots
+    std::vector<Tag> myTags;
+  }; // end of class OpenAddressingHashTreeStorage
+
+  } // namespace experimental
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/HashTreeStorages.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HashTreeStorages_h
+
+#undef HashTreeStorages_RECURSES
+#endif // else defined(HashTreeStorages_RECURSES)
@@ -69,11 +69,20 @@ namespace DGtal
  * @tparam TReadPolicy a read policy class.
  * @tparam TWritePolicy a write policy class.
  * 
- * The cache provides 3 functions:
+ * The cache provides 4 functions:
  * 
  *  - read :    for getting the value of an image from cache at a given position given by a point only if that point belongs to an image from cache
  *  - write :   for setting a   value on an image from cache at a given position given by a point only if that point belongs to an image from cache
  *  - update :  for updating the cache according to the read cache policy
+ *  - clearCache :  for flushing and detaching all the images of the cache
+ * 
+ * The cache counts its hits (read or write of a point in a page of
+ * the cache), misses (read or write of a point outside the pages of
+ * the cache) and evictions (pages detached by update). The access
+ * retried just after the update() following a miss (as done by
+ * TiledImageFromImage) is part of the miss and is not counted as a
+ * hit. The bytes written back to the underlying image are counted by
+ * the write policies.
  */
 template <typename TImageContainer, typename TImageFactory, typename TReadPolicy, typename TWritePolicy>
 class ImageCache
@@ -114,6 +123,7 @@ public:
     ImageCache(Alias<ImageFactory> anImageFactory, Alias<ReadPolicy> aReadPolicy, Alias<WritePolicy> aWritePolicy):
       myImageFactoryPtr(anImageFactory), myReadPolicy(aReadPolicy), myWritePolicy(aWritePolicy)
     {
+      resetCounters();
     }
 
     /**
@@ -176,6 +186,49 @@ public:
      * @param aDomain the domain.
      */
     void update(const Domain &aDomain);
+    
+    /**
+     * Clear the cache: all the images of the cache are flushed
+     * according to the write cache policy and detached.
+     */
+    void clearCache();
+
+    /**
+     * @return the number of reads and writes of points in a page of
+     * the cache.
+     */
+    DGtal::uint64_t nbHits() const
+    {
+      return myNbHits;
+    }
+
+    /**
+     * @return the number of reads and writes of points outside the
+     * pages of the cache.
+     */
+    DGtal::uint64_t nbMisses() const
+    {
+      return myNbMisses;
+    }
+
+    /**
+     * @return the number of pages detached by update().
+     */
+    DGtal::uint64_t nbEvictions() const
+    {
+      return myNbEvictions;
+    }
+
+    /**
+     * Resets the hit, miss and eviction counters.
+     */
+    void resetCounters()
+    {
+      myNbHits = 0;
+      myNbMisses = 0;
+      myNbEvictions = 0;
+      myRetry = false;
+    }
 
     // ------------------------- Protected Datas ------------------------------
 private:
@@ -193,12 +246,26 @@ protected:
     /// Alias on the specialized caches
     ReadPolicy * myReadPolicy;
     WritePolicy  * myWritePolicy;
+
+    /// Counters
+    mutable DGtal::uint64_t myNbHits;
+    mutable DGtal::uint64_t myNbMisses;
+    DGtal::uint64_t myNbEvictions;
+
+    /// True between an update() and the next read or write
+    mutable bool myRetry;
     
 private:
 
     // ------------------------- Internals ------------------------------------
 private:
 
+    /**
+     * Counts a hit or a miss of read() or write().
+     * @param aHit 'true' if the point was in a page of the cache.
+     */
+    void count(const bool aHit) const;
+
 }; // end of class ImageCache
 
 
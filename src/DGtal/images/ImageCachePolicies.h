@@ -41,6 +41,8 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <deque>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
@@ -65,10 +67,11 @@ namespace DGtal
  * @tparam TImageContainer an image container type (model of CImage).
  * @tparam TImageFactory an image factory.
  * 
- * The policy is done with 3 functions:
+ * The policy is done with 4 functions:
  * 
  *  - getPage :                 for getting the alias on the image that contains the a point or NULL if no image in the cache contains that point
  *  - getPageToDetach :         for getting the alias on the image that we have to detach or NULL if no image have to be detached
+ *  - getPageToClear :          for getting (and removing from the cache) the alias on any image of the cache or NULL if the cache is empty
  *  - updateCache :             for updating the cache according to the cache policy
  */
 template <typename TImageContainer, typename TImageFactory>
@@ -116,6 +119,14 @@ public:
      */
     ImageContainer * getPageToDetach();
     
+    /**
+     * Get the alias on an image of the cache and remove it from the
+     * cache, or NULL if the cache is empty (used to clear the cache).
+     * 
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPageToClear();
+    
     /**
      * Update the cache according to the cache policy.
      *
@@ -145,10 +156,11 @@ protected:
  * @tparam TImageContainer an image container type (model of CImage).
  * @tparam TImageFactory an image factory.
  * 
- * The policy is done with 3 functions:
+ * The policy is done with 4 functions:
  * 
  *  - getPage :                 for getting the alias on the image that contains the a point or NULL if no image in the cache contains that point
  *  - getPageToDetach :         for getting the alias on the image that we have to detach or NULL if no image have to be detached
+ *  - getPageToClear :          for getting (and removing from the cache) the alias on any image of the cache or NULL if the cache is empty
  *  - updateCache :             for updating the cache according to the cache policy
  */
 template <typename TImageContainer, typename TImageFactory>
@@ -196,6 +208,14 @@ public:
      */
     ImageContainer * getPageToDetach();
     
+    /**
+     * Get the alias on an image of the cache and remove it from the
+     * cache, or NULL if the cache is empty (used to clear the cache).
+     * 
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPageToClear();
+    
     /**
      * Update the cache according to the cache policy.
      *
@@ -216,6 +236,312 @@ protected:
     
 }; // end of class ImageCacheReadPolicyFIFO
 
+/////////////////////////////////////////////////////////////////////////////
+// Template class ImageCacheReadPolicyLRU
+/**
+ * Description of template class 'ImageCacheReadPolicyLRU' <p>
+ * \brief Aim: implements a 'LRU' read policy cache.
+ * 
+ * The cache keeps the pages in a list ordered by their last access,
+ * the most recently used one at the front. When a page needs to be
+ * replaced, the page at the back of the list (the least recently used
+ * one) is selected. Unlike FIFO, a page which is accessed again stays
+ * in the cache, so alternating accesses between a few tiles do not
+ * thrash as long as they fit in the cache.
+ * 
+ * The pages must be the tiles of a regular grid, as produced by
+ * TiledImageFromImage: the domain is cut into @a N tiles per
+ * dimension, of size (extent + N - 1) / N, the last tile along a
+ * dimension being cropped to the domain. A page is then found by
+ * arithmetic on the tile indices, in constant time, instead of a scan
+ * of the pages.
+ * 
+ * @tparam TImageContainer an image container type (model of CImage).
+ * @tparam TImageFactory an image factory.
+ * 
+ * The policy is done with 4 functions:
+ * 
+ *  - getPage :                 for getting the alias on the image that contains the a point or NULL if no image in the cache contains that point
+ *  - getPageToDetach :         for getting the alias on the image that we have to detach or NULL if no image have to be detached
+ *  - getPageToClear :          for getting (and removing from the cache) the alias on any image of the cache or NULL if the cache is empty
+ *  - updateCache :             for updating the cache according to the cache policy
+ */
+template <typename TImageContainer, typename TImageFactory>
+class ImageCacheReadPolicyLRU
+{
+public:
+  
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( CImage<TImageContainer> ));
+    BOOST_CONCEPT_ASSERT(( CImageFactory<TImageFactory> ));    
+    
+    typedef TImageFactory ImageFactory;
+    
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Point Point;
+    typedef typename TImageContainer::Value Value;
+    
+    /**
+     * Constructor.
+     * @param anImageFactory alias on the image factory.
+     * @param aDomain the domain of the tiled image.
+     * @param N how many tiles for each dimension.
+     * @param aCacheSizeMax the maximal number of pages in the cache.
+     */
+    ImageCacheReadPolicyLRU(Alias<ImageFactory> anImageFactory,
+                           const Domain & aDomain,
+                           typename Domain::Integer N,
+                           int aCacheSizeMax=10);
+
+    /**
+     * Destructor.
+     * Does nothing
+     */
+    ~ImageCacheReadPolicyLRU() {}
+    
+    /**
+     * Get the alias on the image that contains the point aPoint
+     * or NULL if no image in the cache contains the point aPoint.
+     * 
+     * @param aPoint the point.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Point & aPoint);
+    
+    /**
+     * Get the alias on the image that we have to detach
+     * or NULL if no image have to be detached.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPageToDetach();
+    
+    /**
+     * Get the alias on an image of the cache and remove it from the
+     * cache, or NULL if the cache is empty (used to clear the cache).
+     * 
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPageToClear();
+    
+    /**
+     * Update the cache according to the cache policy.
+     *
+     * @param aDomain the domain (a tile of the grid).
+     */
+    void updateCache(const Domain &aDomain);
+    
+protected:
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the index of the tile containing aPoint.
+     */
+    std::size_t tileIndex(const Point & aPoint) const;
+
+    /**
+     * Removes the page @a i from the list.
+     * @param i a slot of myPages.
+     */
+    void unlink(const int i);
+
+    /**
+     * Inserts the page @a i at the front of the list.
+     * @param i a slot of myPages.
+     */
+    void pushFront(const int i);
+
+    /// Lower bound of the tiled domain
+    Point myLowerBound;
+
+    /// Upper bound of the tiled domain
+    Point myUpperBound;
+
+    /// Width of a tile (for each dimension)
+    Point myTileSize;
+
+    /// Number of tiles per dimension
+    typename Domain::Integer myN;
+
+    /// A page of the cache, linked in the list ordered by last access
+    struct Page
+    {
+      ImageContainer * image;
+      std::size_t tile;
+      int previous;
+      int next;
+    };
+
+    /// Pages of the cache (or free slots)
+    std::vector<Page> myPages;
+
+    /// Free slots of myPages
+    std::vector<int> myFreePages;
+
+    /// Slot of the page of each tile (-1 if the tile is not in the cache)
+    std::vector<int> myPageOfTile;
+
+    /// Most recently used page (-1 if the cache is empty)
+    int myFirst;
+
+    /// Least recently used page (-1 if the cache is empty)
+    int myLast;
+
+    /// Size max of the cache
+    int myCacheSizeMax;
+    
+    /// Alias on the image factory
+    ImageFactory * myImageFactory;
+    
+}; // end of class ImageCacheReadPolicyLRU
+
+/////////////////////////////////////////////////////////////////////////////
+// Template class ImageCacheReadPolicyCLOCK
+/**
+ * Description of template class 'ImageCacheReadPolicyCLOCK' <p>
+ * \brief Aim: implements a 'CLOCK' read policy cache.
+ * 
+ * The cache keeps the pages in a circular buffer, each one with a
+ * reference bit set when the page is accessed. When a page needs to
+ * be replaced, the clock hand sweeps the buffer, clearing the
+ * reference bits, until it finds a page which has not been
+ * referenced since the last sweep. This approximates LRU, with a
+ * cheaper access (one bit set instead of a list update).
+ * 
+ * The pages must be the tiles of a regular grid, as produced by
+ * TiledImageFromImage: the domain is cut into @a N tiles per
+ * dimension, of size (extent + N - 1) / N, the last tile along a
+ * dimension being cropped to the domain. A page is then found by
+ * arithmetic on the tile indices, in constant time, instead of a scan
+ * of the pages.
+ * 
+ * @tparam TImageContainer an image container type (model of CImage).
+ * @tparam TImageFactory an image factory.
+ * 
+ * The policy is done with 4 functions:
+ * 
+ *  - getPage :                 for getting the alias on the image that contains the a point or NULL if no image in the cache contains that point
+ *  - getPageToDetach :         for getting the alias on the image that we have to detach or NULL if no image have to be detached
+ *  - getPageToClear :          for getting (and removing from the cache) the alias on any image of the cache or NULL if the cache is empty
+ *  - updateCache :             for updating the cache according to the cache policy
+ */
+template <typename TImageContainer, typename TImageFactory>
+class ImageCacheReadPolicyCLOCK
+{
+public:
+  
+    ///Checking concepts
+    BOOST_CONCEPT_ASSERT(( CImage<TImageContainer> ));
+    BOOST_CONCEPT_ASSERT(( CImageFactory<TImageFactory> ));    
+    
+    typedef TImageFactory ImageFactory;
+    
+    typedef TImageContainer ImageContainer;
+    typedef typename TImageContainer::Domain Domain;
+    typedef typename TImageContainer::Point Point;
+    typedef typename TImageContainer::Value Value;
+    
+    /**
+     * Constructor.
+     * @param anImageFactory alias on the image factory.
+     * @param aDomain the domain of the tiled image.
+     * @param N how many tiles for each dimension.
+     * @param aCacheSizeMax the maximal number of pages in the cache.
+     */
+    ImageCacheReadPolicyCLOCK(Alias<ImageFactory> anImageFactory,
+                           const Domain & aDomain,
+                           typename Domain::Integer N,
+                           int aCacheSizeMax=10);
+
+    /**
+     * Destructor.
+     * Does nothing
+     */
+    ~ImageCacheReadPolicyCLOCK() {}
+    
+    /**
+     * Get the alias on the image that contains the point aPoint
+     * or NULL if no image in the cache contains the point aPoint.
+     * 
+     * @param aPoint the point.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPage(const Point & aPoint);
+    
+    /**
+     * Get the alias on the image that we have to detach
+     * or NULL if no image have to be detached.
+     *
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPageToDetach();
+    
+    /**
+     * Get the alias on an image of the cache and remove it from the
+     * cache, or NULL if the cache is empty (used to clear the cache).
+     * 
+     * @return the alias on the image container or NULL pointer.
+     */
+    ImageContainer * getPageToClear();
+    
+    /**
+     * Update the cache according to the cache policy.
+     *
+     * @param aDomain the domain (a tile of the grid).
+     */
+    void updateCache(const Domain &aDomain);
+    
+protected:
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the index of the tile containing aPoint.
+     */
+    std::size_t tileIndex(const Point & aPoint) const;
+
+    /// Lower bound of the tiled domain
+    Point myLowerBound;
+
+    /// Upper bound of the tiled domain
+    Point myUpperBound;
+
+    /// Width of a tile (for each dimension)
+    Point myTileSize;
+
+    /// Number of tiles per dimension
+    typename Domain::Integer myN;
+
+    /// A page of the cache
+    struct Page
+    {
+      ImageContainer * image;
+      std::size_t tile;
+      bool referenced;
+    };
+
+    /// Pages of the cache (circular buffer, NULL images being free slots)
+    std::vector<Page> myPages;
+
+    /// Free slots of myPages
+    std::vector<int> myFreePages;
+
+    /// Slot of the page of each tile (-1 if the tile is not in the cache)
+    std::vector<int> myPageOfTile;
+
+    /// Position of the clock hand in myPages
+    int myHand;
+
+    /// Size max of the cache
+    int myCacheSizeMax;
+    
+    /// Alias on the image factory
+    ImageFactory * myImageFactory;
+    
+}; // end of class ImageCacheReadPolicyCLOCK
+
 /////////////////////////////////////////////////////////////////////////////
 // Template class ImageCacheWritePolicyWT
 /**
@@ -249,7 +575,7 @@ public:
     typedef typename TImageContainer::Value Value;
     
     ImageCacheWritePolicyWT(Alias<ImageFactory> anImageFactory):
-      myImageFactory(anImageFactory)
+      myImageFactory(anImageFactory), myNbFlushedPages(0), myNbFlushedBytes(0)
     {
     }
 
@@ -275,11 +601,43 @@ public:
     * @param anImageContainer the image.
     */
     void flushPage(ImageContainer * anImageContainer);
+
+    /**
+     * @return the number of pages written to the underlying image.
+     */
+    DGtal::uint64_t nbFlushedPages() const
+    {
+      return myNbFlushedPages;
+    }
+
+    /**
+     * @return the number of bytes written to the underlying image
+     * (number of values times sizeof(Value)).
+     */
+    DGtal::uint64_t nbFlushedBytes() const
+    {
+      return myNbFlushedBytes;
+    }
+
+    /**
+     * Resets the flush counters.
+     */
+    void resetCounters()
+    {
+      myNbFlushedPages = 0;
+      myNbFlushedBytes = 0;
+    }
     
 protected:
     
     /// Alias on the image factory
     ImageFactory * myImageFactory;
+
+    /// Number of pages written to the underlying image
+    DGtal::uint64_t myNbFlushedPages;
+
+    /// Number of bytes written to the underlying image
+    DGtal::uint64_t myNbFlushedBytes;
     
 }; // end of class ImageCacheWritePolicyWT
 
@@ -317,7 +675,7 @@ public:
     typedef typename TImageContainer::Value Value;
     
     ImageCacheWritePolicyWB(Alias<ImageFactory> anImageFactory):
-      myImageFactory(anImageFactory)
+      myImageFactory(anImageFactory), myNbFlushedPages(0), myNbFlushedBytes(0)
     {
     }
 
@@ -343,11 +701,43 @@ public:
     * @param anImageContainer the image.
     */
     void flushPage(ImageContainer * anImageContainer);
+
+    /**
+     * @return the number of pages written to the underlying image.
+     */
+    DGtal::uint64_t nbFlushedPages() const
+    {
+      return myNbFlushedPages;
+    }
+
+    /**
+     * @return the number of bytes written to the underlying image
+     * (number of values times sizeof(Value)).
+     */
+    DGtal::uint64_t nbFlushedBytes() const
+    {
+      return myNbFlushedBytes;
+    }
+
+    /**
+     * Resets the flush counters.
+     */
+    void resetCounters()
+    {
+      myNbFlushedPages = 0;
+      myNbFlushedBytes = 0;
+    }
     
 protected:
     
     /// Alias on the image factory
     ImageFactory * myImageFactory;
+
+    /// Number of pages written to the underlying image
+    DGtal::uint64_t myNbFlushedPages;
+
+    /// Number of bytes written to the underlying image
+    DGtal::uint64_t myNbFlushedBytes;
     
 }; // end of class ImageCacheWritePolicyWB
 
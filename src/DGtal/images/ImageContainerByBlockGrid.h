@@ -0,0 +1,421 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByBlockGrid.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ImageContainerByBlockGrid.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByBlockGrid_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByBlockGrid.h
+#else // defined(ImageContainerByBlockGrid_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByBlockGrid_RECURSES
+
+#if !defined ImageContainerByBlockGrid_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByBlockGrid_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/type_traits.hpp>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+#include "DGtal/images/HashTreeStorages.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByBlockGrid
+  /**
+   * Description of template class 'ImageContainerByBlockGrid' <p>
+   * @brief Aim: Model of CImage for sparse images (narrow bands
+   * around surfaces, sparse labels), storing dense blocks of
+   * @f$ 2^{B} \times \dots \times 2^{B}@f$ values in a hashed grid.
+   *
+   * The domain is split into blocks aligned on its lower bound. Only
+   * the blocks in which a value different from the background value
+   * has been set are allocated: the other points have the background
+   * value. A block costs @f$ 2^{Bd}@f$ values, plus about 16 bytes
+   * for its entry in the block index (an
+   * experimental::OpenAddressingHashTreeStorage indexed by the
+   * lexicographic rank of the block in the grid).
+   *
+   * Besides operator() and setValue(), the image provides:
+   * - block iterators (blockBegin(), blockEnd()) visiting the
+   *   allocated blocks only, possibly restricted to a sub-domain, in
+   *   O(number of allocated blocks);
+   * - accessors (ConstAccessor, Accessor) keeping the last visited
+   *   block, so that the accesses to neighbouring points skip the
+   *   hash table lookup;
+   * - prune(), which releases the blocks having the background value
+   *   only.
+   *
+   * The values of a block are stored contiguously, the first
+   * dimension varying first.
+   *
+   * @tparam TDomain type of domain (HyperRectDomain).
+   * @tparam TValue type of values.
+   * @tparam TBlockLog2 logarithm in base 2 of the side of the blocks
+   * (3 for blocks of @f$ 8^d@f$ values).
+   *
+   * @see testImageContainerByBlockGrid.cpp
+   */
+  template <typename TDomain, typename TValue, unsigned int TBlockLog2 = 3>
+  class ImageContainerByBlockGrid
+  {
+  public:
+
+    typedef ImageContainerByBlockGrid<TDomain, TValue, TBlockLog2> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT(( CDomain<TDomain> ));
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    /// static constants
+    static const typename Domain::Dimension dimension = TDomain::Space::dimension;
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain,
+                          HyperRectDomain<SpaceND<dimension, Integer> > >::value ));
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT(( CLabel<TValue> ));
+    typedef TValue Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /// Side of the blocks
+    static const unsigned int blockSide = 1u << TBlockLog2;
+    /// Number of values of a block
+    static const unsigned int blockSize = 1u << ( TBlockLog2 * dimension );
+
+    /// Key of a block in the index (rank of the block in the grid
+    /// plus one, 0 being the empty slot of the table)
+    typedef DGtal::uint64_t BlockKey;
+    /// Index of the blocks: key -> position of the block in the arrays
+    typedef experimental::OpenAddressingHashTreeStorage<BlockKey, unsigned int> BlockIndex;
+
+    /**
+     * Iterator on the allocated blocks intersecting a sub-domain.
+     */
+    class BlockConstIterator
+    {
+    public:
+      BlockConstIterator( const Self & anImage, const unsigned int aBlock,
+                          const Domain & aSubDomain );
+
+      /// @return the part of the current block inside the sub-domain.
+      Domain domain() const;
+
+      /// @return the lower bound of the current (whole) block.
+      const Point & origin() const;
+
+      /// @return the values of the current block.
+      const Value * data() const;
+
+      /**
+       * @param aPoint a point of the current block.
+       * @return its value.
+       */
+      Value operator()( const Point & aPoint ) const;
+
+      BlockConstIterator & operator++();
+      bool operator==( const BlockConstIterator & other ) const;
+      bool operator!=( const BlockConstIterator & other ) const;
+
+    private:
+      const Self * myImage;
+      unsigned int myBlock;
+      Domain mySubDomain;
+    };
+
+    /**
+     * Read access to the values, the last visited block being kept.
+     *
+     * The accessor is not invalidated by the allocation of new blocks,
+     * but should not be used after a prune().
+     */
+    class ConstAccessor
+    {
+    public:
+      ConstAccessor( const Self & anImage );
+
+      /**
+       * @param aPoint a point of the image domain.
+       * @return its value.
+       */
+      Value operator()( const Point & aPoint );
+
+    protected:
+      /// @return the position of the block of key @a aKey (NoBlock if none).
+      unsigned int block( const BlockKey aKey );
+
+      const Self * myImage;
+      BlockKey myKey;
+      unsigned int myBlock;
+    };
+
+    /**
+     * Read and write access to the values, the last visited block
+     * being kept.
+     */
+    class Accessor: public ConstAccessor
+    {
+    public:
+      Accessor( Self & anImage );
+
+      /**
+       * @param aPoint a point of the image domain.
+       * @param aValue its new value.
+       */
+      void setValue( const Point & aPoint, const Value & aValue );
+    };
+
+    /////////////////// standard services //////////////////
+
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aDomain the image domain.
+     * @param aBackground the value of the points outside the
+     * allocated blocks.
+     */
+    ImageContainerByBlockGrid( const Domain & aDomain, const Value & aBackground = 0 );
+
+    /**
+     * Destructor.
+     */
+    ~ImageContainerByBlockGrid();
+
+    /////////////////// Interface //////////////////
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     * Setting the background value outside the allocated blocks
+     * does not allocate a block.
+     *
+     * @pre @c it must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /**
+     * @return an output iterator on the image values.
+     */
+    OutputIterator outputIterator();
+
+    /**
+     * @return the background value.
+     */
+    const Value & background() const;
+
+    /**
+     * @return an iterator on the first allocated block.
+     */
+    BlockConstIterator blockBegin() const;
+
+    /**
+     * @param aSubDomain a sub-domain of the image domain.
+     * @return an iterator on the first allocated block intersecting
+     * @a aSubDomain.
+     */
+    BlockConstIterator blockBegin( const Domain & aSubDomain ) const;
+
+    /**
+     * @return the iterator after the last block.
+     */
+    BlockConstIterator blockEnd() const;
+
+    /**
+     * @return the number of allocated blocks.
+     */
+    unsigned int nbBlocks() const;
+
+    /**
+     * Releases the blocks having the background value only.
+     * @return the number of released blocks.
+     */
+    unsigned int prune();
+
+    /**
+     * @return the memory used by the blocks and the index (bytes).
+     */
+    std::size_t memory() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    friend class BlockConstIterator;
+    friend class ConstAccessor;
+    friend class Accessor;
+
+    /// Position of a missing block
+    static const unsigned int NoBlock = ~0u;
+
+    /**
+     * @param aPoint a point of the domain.
+     * @param anOffset (returns) the position of the point in its block.
+     * @return the key of the block of @a aPoint.
+     */
+    BlockKey blockKey( const Point & aPoint, unsigned int & anOffset ) const;
+
+    /**
+     * @param aKey a block key.
+     * @return the position of the block of key @a aKey (NoBlock if none).
+     */
+    unsigned int findBlock( const BlockKey aKey ) const;
+
+    /**
+     * Allocates the block of a point, filled with the background value.
+     * @param aKey the block key of @a aPoint.
+     * @param aPoint a point of the domain.
+     * @return the position of the new block.
+     */
+    unsigned int createBlock( const BlockKey aKey, const Point & aPoint );
+
+    /**
+     * @param aBlock the position of a block.
+     * @return the first position after @a aBlock of a block
+     * intersecting @a aSubDomain.
+     */
+    unsigned int nextBlock( unsigned int aBlock, const Domain & aSubDomain ) const;
+
+    /////////////////// Data members //////////////////
+  private:
+
+    /// Image domain
+    Domain myDomain;
+
+    /// Background value
+    Value myBackground;
+
+    /// Number of blocks along each dimension
+    Vector myGridExtent;
+
+    /// Index of the blocks
+    BlockIndex myIndex;
+
+    /// Values of the blocks (blockSize values per block)
+    std::vector<Value> myValues;
+
+    /// Lower bounds of the blocks
+    std::vector<Point> myOrigins;
+
+  }; // end of class ImageContainerByBlockGrid
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByBlockGrid'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByBlockGrid' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue, unsigned int TBlockLog2>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerByBlockGrid<TDomain, TValue, TBlockLog2> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByBlockGrid.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByBlockGrid_h
+
+#undef ImageContainerByBlockGrid_RECURSES
+#endif // else defined(ImageContainerByBlockGrid_RECURSES)
@@ -0,0 +1,456 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByCompressedTiles.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ImageContainerByCompressedTiles.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByCompressedTiles_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByCompressedTiles.h
+#else // defined(ImageContainerByCompressedTiles_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByCompressedTiles_RECURSES
+
+#if !defined ImageContainerByCompressedTiles_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByCompressedTiles_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/type_traits.hpp>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Alias.h"
+#include "DGtal/base/Executors.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/TileCodecs.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByCompressedTiles
+  /**
+   * Description of template class 'ImageContainerByCompressedTiles' <p>
+   * @brief Aim: Model of CImage keeping the values of a (label,
+   * binary) image compressed in memory, tile by tile.
+   *
+   * The domain is split into tiles of a given extent, aligned on its
+   * lower bound (the last tiles along each dimension may be
+   * smaller). The values of each tile are stored compressed by the
+   * codec (see TileCodecs.h): RLETileCodec for labels,
+   * BitPackingTileCodec for binary images, LZTileCodec for
+   * repetitive patterns, or AdaptiveTileCodec choosing the best one
+   * for each tile.
+   *
+   * operator() and setValue() work on a cache of one decoded tile:
+   * the tile of the point is decoded when the cache holds another
+   * one, and a modified tile is encoded again only when it leaves the
+   * cache (or when the codes are read, e.g. by compressedSize()).
+   * operator() reads the values of the other tiles directly from
+   * their codes when the codec has a cheap random access (RLE, bit
+   * packing).
+   * Per-voxel accesses with some locality (scans, neighbourhoods)
+   * thus cost O(1), but an access to another tile than the previous
+   * one costs the decoding of a tile. Algorithms jumping between
+   * tiles should rather process the values by tiles, through
+   * getValues() and setValues(), or through a TiledImageFromImage
+   * (or ConcurrentTiledImageFromImage) whose factory,
+   * ImageFactoryFromImage<ImageContainerByCompressedTiles>, decodes a
+   * tile when it is loaded in the cache and encodes it when it is
+   * flushed. With the same tile extent in both images (i.e. an
+   * extent of @f$ \lceil n / N \rceil@f$ for @a N tiles per
+   * dimension in the tiled image), each cache page is one tile.
+   *
+   * The const methods may be called by several threads at the same
+   * time (e.g. by the tasks of an executor): operator() reads the
+   * codes directly when the codec has a cheap random access, and
+   * otherwise, like getValues() and compressedSize(), accesses the
+   * cached tile under a lock (ExecutorMutex). Concurrent per-voxel
+   * reads with an LZ or adaptive codec thus share and refill a single
+   * cached tile; they should rather use one TiledImageFromImage per
+   * thread (a per-thread cache of decoded tiles) sharing the same
+   * factory, since getValues() decodes the tiles in local
+   * buffers. setValues() on distinct tiles may also run at the same
+   * time, but setValue() and setValues() must not run with the other
+   * methods.
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue type of values, compressed as they are stored in
+   * memory.
+   * @tparam TCodec the tile codec (default: RLETileCodec).
+   *
+   * @see testImageContainerByCompressedTiles.cpp
+   */
+  template <typename TDomain, typename TValue, typename TCodec = RLETileCodec<TValue> >
+  class ImageContainerByCompressedTiles
+  {
+  public:
+
+    typedef ImageContainerByCompressedTiles<TDomain, TValue, TCodec> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT(( CDomain<TDomain> ));
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    /// static constants
+    static const typename Domain::Dimension dimension = TDomain::Space::dimension;
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain,
+                          HyperRectDomain<SpaceND<dimension, Integer> > >::value ));
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT(( CLabel<TValue> ));
+    typedef TValue Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /// codec
+    typedef TCodec Codec;
+    typedef std::vector<unsigned char> Code;
+
+    /////////////////// standard services //////////////////
+
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param aDomain the image domain.
+     * @param aTileExtent the extent of the tiles.
+     * @param aValue the initial value of the points.
+     */
+    ImageContainerByCompressedTiles( const Domain & aDomain,
+                                     const Vector & aTileExtent,
+                                     const Value & aValue = Value() );
+
+    /**
+     * Destructor.
+     */
+    ~ImageContainerByCompressedTiles();
+
+    /////////////////// Interface //////////////////
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     * The value is written in the cached tile.
+     *
+     * @pre @c it must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /**
+     * @return an output iterator on the image values.
+     */
+    OutputIterator outputIterator();
+
+    /**
+     * @return the extent of the tiles.
+     */
+    const Vector & tileExtent() const;
+
+    /**
+     * @return the number of tiles.
+     */
+    Size nbTiles() const;
+
+    /**
+     * Writes the values of the points of @a aSubDomain, in the order
+     * of the domain iterator, each tile being decoded once.
+     *
+     * @param aSubDomain a sub-domain of the image domain.
+     * @param anOutput a random access iterator on @a
+     * aSubDomain.size() values.
+     *
+     * @tparam TOutputIterator a model of random access iterator.
+     */
+    template <typename TOutputIterator>
+    void getValues( const Domain & aSubDomain, TOutputIterator anOutput ) const;
+
+    /**
+     * Sets the values of the points of @a aSubDomain, given in the
+     * order of the domain iterator, each tile being encoded once.
+     *
+     * @param aSubDomain a sub-domain of the image domain.
+     * @param anInput a random access iterator on @a
+     * aSubDomain.size() values.
+     *
+     * @tparam TInputIterator a model of random access iterator.
+     */
+    template <typename TInputIterator>
+    void setValues( const Domain & aSubDomain, TInputIterator anInput );
+
+    /**
+     * @return the size of the codes of the tiles (bytes), after
+     * encoding the cached tile if it was modified.
+     */
+    std::size_t compressedSize() const;
+
+    /**
+     * @return the size of the values (domain size times the size of a
+     * value) divided by the size of the codes.
+     */
+    double compressionRatio() const;
+
+    /**
+     * @return the memory used by the codes, their vectors and the
+     * cached tile (bytes).
+     */
+    std::size_t memory() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param aTile the coordinates of a tile in the grid.
+     * @return the domain of the tile.
+     */
+    Domain tileDomain( const Point & aTile ) const;
+
+    /**
+     * @param aTile the coordinates of a tile in the grid.
+     * @return the position of its code.
+     */
+    Size tileIndex( const Point & aTile ) const;
+
+    /**
+     * @param aPoint a point of the domain.
+     * @return the coordinates of its tile in the grid.
+     */
+    Point tileOf( const Point & aPoint ) const;
+
+    /**
+     * @param aPoint a point of @a aDomain.
+     * @param aDomain a domain.
+     * @return the position of @a aPoint in the values of @a aDomain.
+     */
+    static Size offset( const Point & aPoint, const Domain & aDomain );
+
+    /**
+     * Decodes a tile in the cache, after encoding the cached tile if
+     * it was modified (by a const method: with myCacheMutex locked).
+     *
+     * @param anIndex the position of the code of the tile.
+     * @param aSize the number of points of the tile.
+     */
+    void cacheTile( Size anIndex, Size aSize ) const;
+
+    /**
+     * Encodes the cached tile if it was modified (by a const method:
+     * with myCacheMutex locked).
+     */
+    void flushCache() const;
+
+    /////////////////// Data members //////////////////
+  private:
+
+    /// Image domain
+    Domain myDomain;
+
+    /// Extent of the tiles
+    Vector myTileExtent;
+
+    /// Number of tiles along each dimension
+    Vector myGridExtent;
+
+    /// Codes of the tiles (the cached tile is encoded by const methods)
+    mutable std::vector<Code> myCodes;
+
+    /// Decoded values of the cached tile
+    mutable std::vector<Value> myCacheValues;
+
+    /// Position of the code of the cached tile (nbTiles() if none)
+    mutable Size myCacheIndex;
+
+    /// 'true' if the cached values were modified since their decoding
+    mutable bool myCacheDirty;
+
+    /// Protects the cache from concurrent const methods
+    mutable ExecutorMutex myCacheMutex;
+
+  }; // end of class ImageContainerByCompressedTiles
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageFactoryFromImage<ImageContainerByCompressedTiles>
+  /**
+   * Description of template class 'ImageFactoryFromImage' <p>
+   * \brief Aim: Partial specialization of ImageFactoryFromImage for
+   * ImageContainerByCompressedTiles: the images are decoded with
+   * getValues() and flushed with setValues().
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue type of values.
+   * @tparam TCodec the tile codec.
+   */
+  template <typename TDomain, typename TValue, typename TCodec>
+  class ImageFactoryFromImage< ImageContainerByCompressedTiles<TDomain, TValue, TCodec> >
+  {
+  public:
+    typedef ImageContainerByCompressedTiles<TDomain, TValue, TCodec> ImageContainer;
+    typedef ImageFactoryFromImage<ImageContainer> Self;
+    typedef typename ImageContainer::Domain Domain;
+    typedef typename ImageContainer::Value Value;
+    typedef ImageContainerBySTLVector<Domain, Value> OutputImage;
+
+    /**
+     * Constructor.
+     * @param anImage alias on the underlying image container.
+     */
+    ImageFactoryFromImage( Alias<ImageContainer> anImage )
+      : myImagePtr( anImage )
+    {}
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @param aDomain the domain.
+     * @return a new image with the values of @a aDomain.
+     */
+    OutputImage * requestImage( const Domain & aDomain );
+
+    /**
+     * Writes the values of an OutputImage in the compressed image.
+     * @param outputImage the OutputImage.
+     */
+    void flushImage( OutputImage * outputImage );
+
+    /**
+     * Free (i.e. delete) an OutputImage.
+     * @param outputImage the OutputImage.
+     */
+    void detachImage( OutputImage * outputImage );
+
+  protected:
+
+    /// Alias on the image container
+    ImageContainer * myImagePtr;
+
+  }; // end of class ImageFactoryFromImage<ImageContainerByCompressedTiles>
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByCompressedTiles'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByCompressedTiles' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue, typename TCodec>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerByCompressedTiles<TDomain, TValue, TCodec> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByCompressedTiles.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByCompressedTiles_h
+
+#undef ImageContainerByCompressedTiles_RECURSES
+#endif // else defined(ImageContainerByCompressedTiles_RECURSES)
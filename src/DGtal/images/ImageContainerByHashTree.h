@@ -42,17 +42,22 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
+#include <utility>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/Executors.h"
 #include "DGtal/base/CLabel.h"
 #include "DGtal/base/ConstRangeAdapter.h"
 #include "DGtal/images/DefaultConstImageRange.h"
 #include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 
 #include "DGtal/kernel/domains/CDomain.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/base/Bits.h"
 #include "DGtal/images/Morton.h"
+#include "DGtal/images/HashTreeStorages.h"
 #include "DGtal/images/SetValueIterator.h"
 #include "DGtal/io/Color.h"
 #include "DGtal/base/ExpressionTemplates.h"
@@ -120,24 +125,30 @@ namespace DGtal
    * @tparam TValue type for image values
    * @taparam THashKey  type to store Morton keys
    * (default: DGtal::uint64_t)
+   * @tparam TStorage type of the node storage, indexed by the
+   * keys: OpenAddressingHashTreeStorage (default, flat table growing
+   * with the number of nodes) or LinkedHashTreeStorage (array of
+   * @f$ 2^K@f$ linked lists, K being the hash key size).
    * 
    * @see testImageContainerByHashTree.cpp
    *       
    * */
-  template < typename TDomain, typename TValue, typename THashKey = typename DGtal::uint64_t >
+  template < typename TDomain, typename TValue, typename THashKey = typename DGtal::uint64_t,
+             typename TStorage = OpenAddressingHashTreeStorage<THashKey, TValue> >
   class ImageContainerByHashTree
   {
 
-  protected:
-    class Node;
-  
- 
   public:
 
-    typedef ImageContainerByHashTree<TDomain, TValue, THashKey> Self; 
+    typedef ImageContainerByHashTree<TDomain, TValue, THashKey, TStorage> Self; 
         
     typedef THashKey HashKey;
 
+    /// node storage
+    typedef TStorage Storage;
+    /// a (key, value) node of the storage
+    typedef typename Storage::Node Node;
+
     /// domain
     BOOST_CONCEPT_ASSERT(( CDomain<TDomain> ));
     typedef TDomain Domain;
@@ -175,11 +186,13 @@ namespace DGtal
      * The constructor from a \a hashKeySize, a @a depth and a 
      * @a defaultValue.
      *
-     * @param hashKeySize Number of bit of the hash key. This
-     * parameter is important as it influences the amount of
-     * collisions in the hash table. A value K creates an array of
-     * length 2^K with potential unused cells so a compromise between
-     * speed and memory usage is to be done here.
+     * @param hashKeySize Number of bit of the hash key. A value K
+     * creates an array of length 2^K with potential unused cells.
+     * With LinkedHashTreeStorage, this parameter is important as it
+     * influences the amount of collisions in the hash table so a
+     * compromise between speed and memory usage is to be done
+     * here. OpenAddressingHashTreeStorage grows the array with the
+     * number of nodes.
      *
      * @param depth Determines the maximum depth of the tree and thus
      * qthe "size" of the image. Each span then extends from 0 to
@@ -198,11 +211,13 @@ namespace DGtal
      * of the tree is given by the logarithm of the domain size
      * defined by the two points. 
      *
-     * @param hashKeySize Number of bit of the hash key. This
-     * parameter is important as it influences the amount of
-     * collisions in the hash table. A value K creates an array of
-     * length 2^K with potential unused cells so a compromise between
-     * speed and memory usage is to be done here.
+     * @param hashKeySize Number of bit of the hash key. A value K
+     * creates an array of length 2^K with potential unused cells.
+     * With LinkedHashTreeStorage, this parameter is important as it
+     * influences the amount of collisions in the hash table so a
+     * compromise between speed and memory usage is to be done
+     * here. OpenAddressingHashTreeStorage grows the array with the
+     * number of nodes.
      *
      * @param p1 First point of the image bounding box.
      * @param p2 Second point of the image bounding box.
@@ -222,11 +237,13 @@ namespace DGtal
      * defined by the two points. 
      *
      * @param aDomain the image domain
-     * @param hashKeySize Number of bit of the hash key. This
-     * parameter is important as it influences the amount of
-     * collisions in the hash table. A value K creates an array of
-     * length 2^K with potential unused cells so a compromise between
-     * speed and memory usage is to be done here (default: 3).
+     * @param hashKeySize Number of bit of the hash key. A value K
+     * creates an array of length 2^K with potential unused cells.
+     * With LinkedHashTreeStorage, this parameter is important as it
+     * influences the amount of collisions in the hash table so a
+     * compromise between speed and memory usage is to be done here.
+     * OpenAddressingHashTreeStorage grows the array with the number
+     * of nodes (default: 3).
      *
      * @param defaultValue In order for the tree to be valid it needs
      * a default value at the root (key = 1)
@@ -360,6 +377,64 @@ namespace DGtal
      */
     void setValue(const Point& aPoint, const Value object);
 
+    /**
+     * Bulk loading: replaces the content of the tree by the values of
+     * @a anImage, built bottom-up instead of calling setValue() per
+     * point.
+     *
+     * The children keys are derived from the parent keys (no Morton
+     * interleaving per point) and the homogeneous octants (quadrants,
+     * ...) are merged during the sweep, so that the tree has as few
+     * leaves as possible. The tree span is cut into independent
+     * subtrees built by @a anExecutor, the top levels being merged
+     * afterwards. The points of the tree span outside the image
+     * domain are merged with any value (their value is
+     * meaningless). The hash key size is kept.
+     *
+     * @tparam TImage a model of CConstImage with the same point type.
+     * @tparam TExecutor the type of executor (see Executors.h).
+     * @param anImage the image to load.
+     * @param anExecutor the executor building the subtrees.
+     */
+    template <typename TImage, typename TExecutor>
+    void bulkLoad(const TImage & anImage, const TExecutor & anExecutor);
+
+    /**
+     * Bulk loading with the DefaultExecutor.
+     * @param anImage the image to load.
+     */
+    template <typename TImage>
+    void bulkLoad(const TImage & anImage);
+
+    /**
+     * Bulk export: writes the values of the tree into @a anImage at
+     * the points of its domain (which should be included in the tree
+     * span), leaf by leaf: each leaf is decoded once and its whole
+     * block is written, instead of calling get() per point.
+     *
+     * The leaves are split into chunks run by @a anExecutor: the
+     * setValue() method of the image must support concurrent calls
+     * on distinct points (e.g. ImageContainerBySTLVector) when the
+     * executor has several workers.
+     *
+     * @tparam TImage a model of CImage with the same point type.
+     * @tparam TExecutor the type of executor (see Executors.h).
+     * @param anImage the image to fill.
+     * @param anExecutor the executor writing the leaves.
+     */
+    template <typename TImage, typename TExecutor>
+    void bulkExport(TImage & anImage, const TExecutor & anExecutor) const;
+
+    /**
+     * Bulk export with the DefaultExecutor when @a anImage is an
+     * ImageContainerBySTLVector (not of bool values, which share
+     * words), with the SerialExecutor otherwise: the other images do
+     * not support concurrent setValue() calls.
+     * @param anImage the image to fill.
+     */
+    template <typename TImage>
+    void bulkExport(TImage & anImage) const;
+
     /**
      * Returns the size of a dimension (the container represents a
      * line, a square, a cube, etc. depending on the dimmension so no
@@ -483,72 +558,18 @@ namespace DGtal
     unsigned int getNbNodes()const;
 
 
-    // -------------------------------------------------------------
-    /*  Iterator inner-class
-     *
-     *  @brief Buil-in iterator on an HashTree. This iterator visits
-     *  all node in the tree.
-     *
-     * -------------------------------------------------------------
+    /**
+     *  Buil-in iterator on an HashTree. This iterator visits all
+     *  node in the tree, in the order of the storage.
      */
-    class Iterator
-    {
-    public:
-      Iterator(Node** data, unsigned int position, unsigned int arraySize)
-      {
-        myArraySize = arraySize;
-        myContainerData = data;
-        myNode = data[0];
-        myCurrentCell = position;
-        while ((!myNode) && (myCurrentCell < myArraySize))
-          {
-            myNode = myContainerData[++myCurrentCell];
-          }
-      }
-      bool isAtEnd()const
-      {
-        return myCurrentCell >= myArraySize;
-      }
-      Value& operator*()
-      {
-        return myNode->getObject();
-      }
-      bool operator ++ ()
-      {
-        return next();
-      }
-      bool operator == (const Iterator& it)
-      {
-        if (isAtEnd() && it.isAtEnd())
-          return true;
-        else
-          return (myNode == it.myNode);
-      }
-      bool operator != (const Iterator& it)
-      {
-        if (isAtEnd() && it.isAtEnd())
-          return false;
-        else
-          return (myNode != it.myNode);
-      }
-      inline HashKey getKey() const
-      {
-        return myNode->getKey();
-      }
-      bool next();
-    protected:
-      Node* myNode;
-      unsigned int myCurrentCell;
-      unsigned int myArraySize;
-      Node** myContainerData;
-    };
+    typedef typename Storage::Iterator Iterator;
 
     /**
      * Returns an iterator to the first value as stored in the container.
      */
     Iterator begin()
     {
-      return Iterator(myData, 0, myArraySize);
+      return myStorage.begin();
     }
 
     /**
@@ -556,7 +577,7 @@ namespace DGtal
      */
     Iterator end()
     {
-      return Iterator(myData, myArraySize, myArraySize);
+      return myStorage.end();
     }
 
     void selfDisplay(std::ostream & out);
@@ -589,87 +610,10 @@ namespace DGtal
     recursiveDraw(HashKey key, const double p1[2], const double len, Board2D & board, const C& cmap) const;
 
 
-    // -------------------------------------------------------------
-    /**
-     * @class Node
-     *
-     * An internal class that corresponds to a node of a linked list (as the hashTable points to linked
-     * lists to handle collisions). Each element in the container is placed in a Node.
-     */
-    class Node
-    {
-    public:
-
-      /** 
-       * Construtctor: create pair (@a aValue, @a key)
-       * 
-       * @param aValue  First value
-       * @param key     key in the hashtree 
-       */
-      Node(Value aValue, HashKey key)
-      {
-        myData = aValue;
-        myKey = key;
-      }
-
-      /** 
-       * @return the next pair (aValue, key) in the list.
-       */
-      inline Node* getNext()
-      {
-        return myNext;
-      }
-
-
-      /** 
-       * Insert the pair (value,key)  @a next in the node list 
-       * 
-       * @param next a pointer to a pair (value,key) (Node).
-       */	
-      inline void setNext(Node* next)
-      {
-        myNext = next;
-      }
-
-      /** 
-       * 
-       * @return the key associated to a Node. 
-       */
-      inline HashKey getKey()
-      {
-        return myKey;
-      }
-	
-      /** 
-       * 
-       * @return the object (aValue) associated to a Node.
-       */
-      inline Value& getObject()
-      {
-        return myData;
-      }
-      ~Node() { }
-    protected:
-      HashKey myKey;
-      Node* myNext;
-      Value myData;
-    };// -----------------------------------------------------------
-
-
-    /**
-     * This is part of the hash function. It is called whenever a key
-     * is accessed.  The mask used to compute the result is
-     * precomputed in the constructor for efficiency.
-     *
-     * @param key a node in the hashtree.
-     */
-    inline HashKey getIntermediateKey(const HashKey key) const;
-
-
     /**
      * Add a Node to the tree.  This method is very used when writing
-     * in the tree (set method). As detailed in the inner class
-     * Node, nodes are pairs (value,key)
+     * in the tree (set method). Nodes are pairs (value,key) stored
+     * in the storage.
      *
      * @param object a object (value)
      * @param key a hashtree key
@@ -684,11 +628,7 @@ namespace DGtal
           //n->setObject(object);
           return n;
         }
-      n = new Node(object, key);
-      HashKey key2 = getIntermediateKey(key);
-      n->setNext(myData[key2]);
-      myData[key2] = n;
-      return n;
+      return myStorage.insert(key, object);
     }
 
   public:
@@ -701,14 +641,7 @@ namespace DGtal
      */
     inline Node* getNode(const HashKey key)  const  // very used !! // public because Display2DFactory !!!
     {
-      Node* iter = myData[getIntermediateKey(key)];
-      while (iter != 0)
-        {
-          if (iter->getKey() == key)
-            return iter;
-          iter = iter->getNext();
-        }
-      return 0;
+      return myStorage.find(key);
     }
   protected:
 
@@ -743,6 +676,81 @@ namespace DGtal
      */
     Value blendChildren(HashKey key) const;
 
+    /// A leaf (key, value) produced by bulkLoad().
+    typedef std::pair<HashKey, Value> Leaf;
+    typedef std::vector<Leaf> Leaves;
+
+    /**
+     * Summary of a subtree built by bulkLoad(): no point of the image
+     * (Empty), all its points with the same value (Homogeneous) or
+     * already emitted as several leaves (Mixed).
+     */
+    struct Subtree
+    {
+      enum State { Empty, Homogeneous, Mixed };
+      State state;
+      Value value;
+    };
+
+    /**
+     * Builds the subtree of key @a key (of depth @a level, whose
+     * first point is @a aCorner relatively to the origin) from the
+     * image values, the leaves of its mixed nodes being appended to
+     * @a aLeaves.
+     */
+    template <typename TImage>
+    Subtree buildSubtree(const TImage & anImage, const HashKey key,
+                         const unsigned int level, const Point & aCorner,
+                         Leaves & aLeaves) const;
+
+    /**
+     * Merges the summaries @a someChildren of the children of
+     * @a key into the summary of @a key, the leaves of a mixed node
+     * being appended to @a aLeaves.
+     */
+    Subtree mergeChildren(const HashKey key, const Subtree * someChildren,
+                          Leaves & aLeaves) const;
+
+    /**
+     * Merges the summaries of the subtrees of depth @a aSplitLevel
+     * into the summary of the subtree of key @a key.
+     */
+    Subtree mergeTop(const HashKey key, const unsigned int level,
+                     const unsigned int aSplitLevel,
+                     const std::vector<Subtree> & someSubtrees,
+                     Leaves & aLeaves) const;
+
+    /**
+     * Task of bulkLoad(): builds the subtrees of depth @a level.
+     */
+    template <typename TImage>
+    struct BuildTask
+    {
+      const Self * self;
+      const TImage * image;
+      unsigned int level;
+      std::vector<Leaves> * leaves;
+      std::vector<Subtree> * subtrees;
+
+      void operator()(const std::size_t worker, const std::size_t i) const;
+    };
+    template <typename TImage> friend struct BuildTask;
+
+    /**
+     * Task of bulkExport(): writes a chunk of leaves.
+     */
+    template <typename TImage>
+    struct ExportTask
+    {
+      const Self * self;
+      TImage * image;
+      const Leaves * leaves;
+      std::size_t chunkSize;
+
+      void operator()(const std::size_t worker, const std::size_t i) const;
+    };
+    template <typename TImage> friend struct ExportTask;
+
 
     //----------------------- internal data --------------------------------
   protected: 
@@ -753,9 +761,9 @@ namespace DGtal
     Domain myDomain;
 
     /**
-     * The array of linked lists containing all the data
+     * The node storage containing all the data
      */
-    Node** myData;
+    Storage myStorage;
 
     /**
      * The size of the intermediate hashkey. The bigger the less
@@ -764,8 +772,6 @@ namespace DGtal
      */
     unsigned int myKeySize;
 
-    unsigned int myArraySize;
-
     /**
      * The depth of the tree
      */
@@ -786,7 +792,6 @@ namespace DGtal
      * Precoputed masks to avoid recalculating it all the time
      */
     HashKey myDepthMask;
-    HashKey myPreComputedIntermediateMask; // ~((~0) << _keySize)
 
   public:
     ///The morton code computer.
@@ -801,9 +806,9 @@ namespace DGtal
    * @param object the object of class 'ImageContainerByHashTree' to write.
    * @return the output stream after the writing.
    */
-  template<typename TDomain, typename TValue, typename THashKey >
+  template<typename TDomain, typename TValue, typename THashKey, typename TStorage >
   std::ostream&
-  operator<< ( std::ostream & out,  ImageContainerByHashTree<TDomain, TValue, THashKey> & object )
+  operator<< ( std::ostream & out,  ImageContainerByHashTree<TDomain, TValue, THashKey, TStorage> & object )
   {
     object.selfDisplay( out);
     return out;
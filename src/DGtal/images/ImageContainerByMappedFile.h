@@ -0,0 +1,381 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByMappedFile.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module ImageContainerByMappedFile.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByMappedFile_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByMappedFile.h
+#else // defined(ImageContainerByMappedFile_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByMappedFile_RECURSES
+
+#if !defined ImageContainerByMappedFile_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByMappedFile_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <cstddef>
+#include <boost/type_traits.hpp>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/base/CountedPtr.h"
+#include "DGtal/base/Exceptions.h"
+#include "DGtal/base/SimpleRandomAccessConstRangeFromPoint.h"
+#include "DGtal/base/SimpleRandomAccessRangeFromPoint.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+#if !defined(WIN32)
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageContainerByMappedFile
+  /**
+   * Description of template class 'ImageContainerByMappedFile' <p>
+   * @brief Aim: Model of CImage whose values are those of a raw file
+   * (or of the data of a vol file) mapped in memory with mmap.
+   *
+   * The file is not read at construction: the pages are loaded by the
+   * operating system when they are first accessed, and may be evicted
+   * from the page cache when the memory is needed, so that volumes
+   * larger than the physical memory can be processed by the usual
+   * algorithms with no loading time.
+   *
+   * The values are stored as in ImageContainerBySTLVector (same
+   * linearized() order, the first dimension varying first), in the
+   * native byte order. The mapping is either:
+   * - ReadOnly: setValue() must not be called;
+   * - CopyOnWrite: the modified pages are private copies, the file is
+   *   never modified;
+   * - ReadWrite: the modifications are written back to the file.
+   *
+   * Access hints (advise()) tell the operating system whether the
+   * values are going to be scanned (read ahead) or randomly accessed.
+   *
+   * The copies of an image share the same mapping, which is released
+   * with the last copy.
+   *
+   * Not available on Windows.
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @tparam TValue type of values, a model of CLabel whose bytes are
+   * those of the file (e.g. an integral or floating point type).
+   *
+   * @see testImageContainerByMappedFile.cpp
+   */
+  template <typename TDomain, typename TValue>
+  class ImageContainerByMappedFile
+  {
+  public:
+
+    typedef ImageContainerByMappedFile<TDomain, TValue> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT(( CDomain<TDomain> ));
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    /// static constants
+    static const typename Domain::Dimension dimension = TDomain::Space::dimension;
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain,
+                          HyperRectDomain<SpaceND<dimension, Integer> > >::value ));
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT(( CLabel<TValue> ));
+    typedef TValue Value;
+
+    /// built-in iterators
+    typedef Value* Iterator;
+    typedef const Value* ConstIterator;
+    typedef std::ptrdiff_t Difference;
+    typedef Value* OutputIterator;
+
+    /// ranges
+    typedef SimpleRandomAccessConstRangeFromPoint<ConstIterator, DistanceFunctorFromPoint<Self> > ConstRange;
+    typedef SimpleRandomAccessRangeFromPoint<ConstIterator, Iterator, DistanceFunctorFromPoint<Self> > Range;
+
+    /// Mapping modes
+    enum MappingMode { ReadOnly, CopyOnWrite, ReadWrite };
+
+    /// Access hints
+    enum AccessHint { NoHint, Sequential, Random, WillNeed };
+
+    /////////////////// standard services //////////////////
+
+  public:
+
+    /**
+     * Maps the values of a raw file.
+     *
+     * @param aFilename the file name.
+     * @param aDomain the image domain, whose size times the size of
+     * a value (plus @a anOffset) must not exceed the size of the file.
+     * @param aMode the mapping mode.
+     * @param anOffset the position of the first value in the file (in
+     * bytes, a multiple of the alignment of Value).
+     * @param aHint the access hint.
+     *
+     * @throw IOException if the file cannot be opened or mapped, is
+     * too small, or if @a anOffset is not a multiple of the alignment
+     * of Value.
+     */
+    ImageContainerByMappedFile( const std::string & aFilename,
+                                const Domain & aDomain,
+                                MappingMode aMode = ReadOnly,
+                                std::size_t anOffset = 0,
+                                AccessHint aHint = NoHint );
+
+    /**
+     * Maps the data of a vol file (3D images of one byte values). The
+     * domain is [0, X-1] x [0, Y-1] x [0, Z-1], X, Y and Z being read
+     * in the header.
+     *
+     * @param aVolFilename the vol file name.
+     * @param aMode the mapping mode.
+     * @param aHint the access hint.
+     *
+     * @throw IOException if the file cannot be opened or mapped, if its
+     * header is invalid, if its voxel size is not the size of Value or
+     * if the length of its header is not a multiple of the alignment
+     * of Value (the values would not be aligned in memory).
+     */
+    ImageContainerByMappedFile( const std::string & aVolFilename,
+                                MappingMode aMode = ReadOnly,
+                                AccessHint aHint = NoHint );
+
+    /**
+     * Destructor. The mapping is released with the last copy.
+     */
+    ~ImageContainerByMappedFile();
+
+    /////////////////// Interface //////////////////
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     *
+     * @pre @c it must be a point in the image domain.
+     * @pre the mapping mode is not ReadOnly.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the domain extension of the image.
+     */
+    Vector extent() const;
+
+    /**
+     * @return the mapping mode.
+     */
+    MappingMode mode() const;
+
+    /**
+     * Tells the operating system how the values are going to be
+     * accessed (madvise).
+     *
+     * @param aHint the access hint.
+     */
+    void advise( AccessHint aHint ) const;
+
+    /**
+     * Writes the modified values of a ReadWrite mapping to the file
+     * (msync); does nothing for the other modes.
+     */
+    void flush();
+
+    /**
+     * Compute the linearized offset of a point in the mapped values.
+     *
+     * @param aPoint a point of the domain.
+     * @return the position of its value.
+     */
+    Size linearized( const Point & aPoint ) const;
+
+    /**
+     * @return an iterator on the first value.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return an iterator after the last value.
+     */
+    ConstIterator end() const;
+
+    /**
+     * @pre the mapping mode is not ReadOnly to write through the
+     * iterator.
+     * @return an iterator on the first value.
+     */
+    Iterator begin();
+
+    /**
+     * @return an iterator after the last value.
+     */
+    Iterator end();
+
+    /**
+     * @return the range providing constant iterators to scan the
+     * values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @pre the mapping mode is not ReadOnly to write in the range.
+     * @return the range providing iterators to scan and write the
+     * values of the image.
+     */
+    Range range();
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay( std::ostream & out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * A mapped file, unmapped at destruction.
+     */
+    struct Mapping
+    {
+      Mapping( const std::string & aFilename, MappingMode aMode,
+               std::size_t anOffset, std::size_t aLength );
+      ~Mapping();
+
+      std::string filename;
+      MappingMode mode;
+      /// Address of the mapping (the beginning of the file)
+      void * address;
+      /// Length of the mapping (bytes)
+      std::size_t length;
+      /// First value
+      Value * values;
+    };
+
+    /**
+     * Reads the header of a vol file.
+     * @param aVolFilename the vol file name.
+     * @param anExtent (returns) the extent read in the header.
+     * @return the position of the data in the file.
+     */
+    static std::size_t readVolHeader( const std::string & aVolFilename,
+                                      Vector & anExtent );
+
+    /**
+     * Sets the domain and maps the file.
+     */
+    void init( const std::string & aFilename, const Domain & aDomain,
+               MappingMode aMode, std::size_t anOffset, AccessHint aHint );
+
+    /////////////////// Data members //////////////////
+  private:
+
+    /// Image domain
+    Domain myDomain;
+
+    /// Domain extent (stored for linearization efficiency)
+    Vector myExtent;
+
+    /// Mapping, shared by the copies
+    CountedPtr<Mapping> myMapping;
+
+  }; // end of class ImageContainerByMappedFile
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByMappedFile'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByMappedFile' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerByMappedFile<TDomain, TValue> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/ImageContainerByMappedFile.ih"
+
+#endif // !defined(WIN32)
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByMappedFile_h
+
+#undef ImageContainerByMappedFile_RECURSES
+#endif // else defined(ImageContainerByMappedFile_RECURSES)
@@ -47,6 +47,7 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <boost/iterator/iterator_facade.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/SimpleRandomAccessConstRangeFromPoint.h"
 #include "DGtal/base/SimpleRandomAccessRangeFromPoint.h"
@@ -288,6 +289,177 @@ namespace DGtal
     Range range();
 
 
+    /////////////////////////// Row ranges  /////////////////////
+
+    /**
+     * Range of the rows of a sub-domain, i.e. of its segments
+     * parallel to the first axis, whose values are contiguous in the
+     * vector. Each row is given as a RowSpan (first point, iterator on
+     * its first value, number of values), so that the values of a row
+     * are scanned by a simple loop without linearizing the points.
+     *
+     * The range is random access, through operator[] or its
+     * iterators, and can be split into balanced chunks (e.g. one per
+     * task of an executor, see Executors.h).
+     *
+     * @tparam TImagePtr pointer on the (const) image.
+     * @tparam TIterator iterator on the (const) values.
+     */
+    template <typename TImagePtr, typename TIterator>
+    class RowSpanRange
+    {
+    public:
+      /// A row: first point, iterator on the first value, length.
+      struct RowSpan
+      {
+        Point start;
+        TIterator values;
+        Size length;
+      };
+
+      /**
+       * Random access iterator on the rows of a range. The rows are
+       * computed when the iterator is dereferenced.
+       */
+      class ConstIterator
+        : public boost::iterator_facade< ConstIterator, RowSpan,
+                                         boost::random_access_traversal_tag,
+                                         RowSpan >
+      {
+      public:
+        ConstIterator()
+          : myRange( 0 ), myIndex( 0 )
+        {}
+        ConstIterator( const RowSpanRange * aRange, Size anIndex )
+          : myRange( aRange ), myIndex( anIndex )
+        {}
+
+      private:
+        friend class boost::iterator_core_access;
+        RowSpan dereference() const
+        {
+          return (*myRange)[ myIndex ];
+        }
+        bool equal( const ConstIterator & other ) const
+        {
+          return myIndex == other.myIndex;
+        }
+        void increment()
+        {
+          ++myIndex;
+        }
+        void decrement()
+        {
+          --myIndex;
+        }
+        void advance( std::ptrdiff_t n )
+        {
+          myIndex += n;
+        }
+        std::ptrdiff_t distance_to( const ConstIterator & other ) const
+        {
+          return (std::ptrdiff_t) other.myIndex - (std::ptrdiff_t) myIndex;
+        }
+
+        /// The range, which must outlive the iterator
+        const RowSpanRange * myRange;
+        /// Index of the row in the range
+        Size myIndex;
+      };
+
+      /**
+       * Constructor.
+       * @param anImage the image.
+       * @param aSubDomain a sub-domain of the image domain.
+       */
+      RowSpanRange( TImagePtr anImage, const Domain & aSubDomain )
+        : myImage( anImage ), mySubDomain( aSubDomain ),
+          myFirst( 0 ), myLast( aSubDomain.nbRows() )
+      {}
+
+      /// @return the number of rows.
+      Size size() const
+      {
+        return myLast - myFirst;
+      }
+
+      /**
+       * @param i a row index in [0, size()).
+       * @return the row @a i.
+       */
+      RowSpan operator[]( const Size i ) const
+      {
+        RowSpan row;
+        row.start = mySubDomain.rowStart( myFirst + i );
+        row.values = myImage->begin() + myImage->linearized( row.start );
+        row.length = mySubDomain.rowLength();
+        return row;
+      }
+
+      /**
+       * @param k a chunk index in [0, n).
+       * @param n the number of chunks.
+       * @return the k-th of @a n consecutive sub-ranges with the
+       * same number of rows (up to one).
+       */
+      RowSpanRange chunk( const Size k, const Size n ) const
+      {
+        RowSpanRange r( *this );
+        r.myFirst = myFirst + ( size() * k ) / n;
+        r.myLast = myFirst + ( size() * ( k + 1 ) ) / n;
+        return r;
+      }
+
+      /**
+       * @return an iterator on the first row (valid as long as the
+       * range).
+       */
+      ConstIterator begin() const
+      {
+        return ConstIterator( this, 0 );
+      }
+
+      /**
+       * @return an iterator after the last row.
+       */
+      ConstIterator end() const
+      {
+        return ConstIterator( this, size() );
+      }
+
+    private:
+      TImagePtr myImage;
+      Domain mySubDomain;
+      Size myFirst;
+      Size myLast;
+    };
+
+    typedef RowSpanRange<Self*, Iterator> RowRange;
+    typedef RowSpanRange<const Self*, ConstIterator> ConstRowRange;
+
+    /**
+     * @return the range of the rows of the image.
+     */
+    RowRange rowRange();
+
+    /**
+     * @param aSubDomain a sub-domain of the image domain.
+     * @return the range of the rows of @a aSubDomain.
+     */
+    RowRange rowRange( const Domain & aSubDomain );
+
+    /**
+     * @return the range of the rows of the image (read only).
+     */
+    ConstRowRange constRowRange() const;
+
+    /**
+     * @param aSubDomain a sub-domain of the image domain.
+     * @return the range of the rows of @a aSubDomain (read only).
+     */
+    ConstRowRange constRowRange( const Domain & aSubDomain ) const;
+
+
     /////////////////////////// Custom Iterator ///////////////
     /**
      * Specific SpanIterator on ImageContainerBySTLVector.
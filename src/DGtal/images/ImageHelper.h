@@ -56,11 +56,13 @@
 #include "DGtal/images/CImage.h"
 #include "DGtal/base/CQuantity.h"
 #include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/images/SetValueIterator.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
 #include "DGtal/kernel/NumberTraits.h"
 #include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/Executors.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -112,7 +114,8 @@ namespace DGtal
    * with the points lying within the domain 
    * of the image @a aImg whose value 
    * (in the image) is less than or equal to 
-   * @a aThreshold
+   * @a aThreshold. The values of an ImageContainerBySTLVector
+   * are scanned row by row.
    *
    * @param aImg any image
    * @param ito set inserter
@@ -131,7 +134,8 @@ namespace DGtal
    * with the points lying within the domain 
    * of the image @a aImg whose value 
    * (in the image) lies between @a low and @a up
-   * (both included) 
+   * (both included). The values of an ImageContainerBySTLVector
+   * are scanned row by row.
    *
    * @param aImg any image
    * @param ito set inserter
@@ -192,6 +196,23 @@ namespace DGtal
   template<typename I, typename F>
   void imageFromFunctor(I& aImg, const F& aFun); 
 
+  /**
+   * In a window corresponding to the domain of @a aImg,
+   * copy the values of @a aFun into @a aImg, the rows of
+   * an ImageContainerBySTLVector being split into chunks run by
+   * @a anExecutor (the other images are filled sequentially).
+   *
+   * @param aImg (returned) image
+   * @param aFun a unary functor, copied for each chunk of rows
+   * @param anExecutor the executor filling the rows
+   *
+   * @tparam I any model of CImage
+   * @tparam F any model of CPointFunctor
+   * @tparam E the type of executor (see Executors.h)
+   */
+  template<typename I, typename F, typename E>
+  void imageFromFunctor(I& aImg, const F& aFun, const E& anExecutor); 
+
   /**
    * Copy the values of @a aImg2 into @a aImg1 .
    *
@@ -203,6 +224,80 @@ namespace DGtal
   template<typename I>
   void imageFromImage(I& aImg1, const I& aImg2); 
 
+  /**
+   * Copy the values of @a aImg2 into @a aImg1, the rows of
+   * an ImageContainerBySTLVector being split into chunks run by
+   * @a anExecutor (the other images are copied sequentially).
+   *
+   * @param aImg1 the image to fill
+   * @param aImg2 the image to copy, whose domain contains the
+   * domain of @a aImg1
+   * @param anExecutor the executor copying the rows
+   *
+   * @tparam I any model of CImage
+   * @tparam E the type of executor (see Executors.h)
+   */
+  template<typename I, typename E>
+  void imageFromImage(I& aImg1, const I& aImg2, const E& anExecutor); 
+
+  /**
+   * Writes the values of @a aImg at the points of @a aSubDomain,
+   * in the order of the domain iterator, through @a anOutput.
+   *
+   * Images whose values are stored row by row
+   * (ImageContainerBySTLVector) copy whole rows. Adapters with
+   * the identity domain functor (ConstImageAdapter with
+   * DefaultFunctor) evaluate the rows of their source in a buffer
+   * with the same function, then apply their value functor to the
+   * buffer, so that a pipeline is evaluated by tight loops instead
+   * of one chain of calls per point. The other images call
+   * operator() at each point.
+   *
+   * @param aImg an image
+   * @param aSubDomain a sub-domain of the image domain
+   * @param anOutput an output iterator on values (e.g. a pointer
+   * on a buffer of @a aSubDomain.size() values)
+   * @return the output iterator after the last written value
+   *
+   * @tparam I any model of CConstImage
+   * @tparam O any model of output iterator
+   */
+  template<typename I, typename O>
+  O evaluateBlock(const I& aImg, const typename I::Domain& aSubDomain, O anOutput);
+
+  /**
+   * Copy the values of @a aImg2 (e.g. an adapter) into @a aImg1,
+   * on the domain of @a aImg1, using evaluateBlock.
+   *
+   * @param aImg1 the image to fill
+   * @param aImg2 the image to copy, whose domain contains the
+   * domain of @a aImg1
+   *
+   * @tparam I any model of CImage
+   * @tparam C any model of CConstImage with the same domain type
+   */
+  template<typename I, typename C>
+  void imageFromConstImage(I& aImg1, const C& aImg2);
+
+  /**
+   * Copy the values of @a aImg2 (e.g. an adapter) into @a aImg1,
+   * on the domain of @a aImg1. When @a aImg1 is an
+   * ImageContainerBySTLVector, each row is written by
+   * evaluateBlock and the rows are split into chunks run by
+   * @a anExecutor.
+   *
+   * @param aImg1 the image to fill
+   * @param aImg2 the image to copy, whose domain contains the
+   * domain of @a aImg1, read from several threads
+   * @param anExecutor the executor evaluating the rows
+   *
+   * @tparam I any model of CImage
+   * @tparam C any model of CConstImage with the same domain type
+   * @tparam E the type of executor (see Executors.h)
+   */
+  template<typename I, typename C, typename E>
+  void imageFromConstImage(I& aImg1, const C& aImg2, const E& anExecutor);
+
   /**
    * Insert @a aPoint in @a aSet and if (and only if)
    * @a aPoint is a newly inserted point. 
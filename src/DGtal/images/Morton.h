@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <cstddef>
 #include <boost/array.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
@@ -49,11 +50,95 @@
 #include "DGtal/kernel/CInteger.h"
 
 #include "DGtal/base/Bits.h"
+
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
 {
 
+  namespace detail
+  {
+    /// Kinds of bit spreading used by Morton
+    enum MortonBitsKind { MORTON_TABLES, MORTON_MAGIC, MORTON_BMI2 };
+
+    /**
+     * Selects at compile time the fastest bit spreading for a key
+     * type and a dimension: pdep/pext for 32 and 64 bits keys when the
+     * compiler targets BMI2, magic numbers for 32 and 64 bits keys in
+     * dimension 2 and 3, byte lookup tables otherwise.
+     */
+    template <typename THashKey, Dimension dim>
+    struct MortonBitsSelector
+    {
+      static const bool isNative = ( sizeof( THashKey ) == 4 ) || ( sizeof( THashKey ) == 8 );
+#ifdef __BMI2__
+      static const MortonBitsKind kind = isNative ? MORTON_BMI2 : MORTON_TABLES;
+#else
+      static const MortonBitsKind kind =
+        ( isNative && ( ( dim == 2 ) || ( dim == 3 ) ) ) ? MORTON_MAGIC : MORTON_TABLES;
+#endif
+    };
+
+    /**
+     * Spreads the bits of a coordinate (bit i moved to bit i*dim) and
+     * compacts them back (bit i*dim moved to bit i, the other bits
+     * being ignored), for coordinates of (bits of THashKey) / dim
+     * bits.
+     *
+     * This generic version uses byte lookup tables, filled at the
+     * construction.
+     */
+    template <typename THashKey, Dimension dim,
+              MortonBitsKind kind = MortonBitsSelector<THashKey, dim>::kind>
+    struct MortonBits
+    {
+      static const unsigned int keyBits = sizeof( THashKey ) * 8;
+      static const unsigned int coordBits = keyBits / dim;
+
+      MortonBits();
+      THashKey spread( THashKey x ) const;
+      THashKey compact( THashKey x ) const;
+
+      /// Spread bits of each byte
+      THashKey mySpread[ 256 ];
+      /// Compacted bits of each byte, for each phase (bit position
+      /// of the byte modulo dim)
+      THashKey myCompact[ dim ][ 256 ];
+    };
+
+    /// Magic numbers bit spreading (dimension 2 and 3, keys of 32
+    /// and 64 bits).
+    template <typename THashKey, Dimension dim>
+    struct MortonBits<THashKey, dim, MORTON_MAGIC>
+    {
+      static const unsigned int keyBits = sizeof( THashKey ) * 8;
+      static const unsigned int coordBits = keyBits / dim;
+
+      THashKey spread( THashKey x ) const;
+      THashKey compact( THashKey x ) const;
+    };
+
+#ifdef __BMI2__
+    /// pdep/pext bit spreading (keys of 32 and 64 bits).
+    template <typename THashKey, Dimension dim>
+    struct MortonBits<THashKey, dim, MORTON_BMI2>
+    {
+      static const unsigned int keyBits = sizeof( THashKey ) * 8;
+      static const unsigned int coordBits = keyBits / dim;
+
+      MortonBits();
+      THashKey spread( THashKey x ) const;
+      THashKey compact( THashKey x ) const;
+
+      /// Bits at the positions multiple of dim
+      THashKey myMask;
+    };
+#endif
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // template class Morton
   /**
@@ -66,6 +151,12 @@ namespace DGtal
    *
    * Main methods in this class are keyFromCoordinates to generate a
    * key and CoordinatesFromKey to generate a point from a code.
+   * encode and decode interleave and deinterleave arrays of points.
+   *
+   * The bits are spread with pdep/pext when the compiler targets the
+   * BMI2 instruction set (e.g. -mbmi2 or -march=native), with magic
+   * numbers in dimension 2 and 3, and with byte lookup tables
+   * otherwise (see detail::MortonBitsSelector).
    *
    * @tparam THashKey type to store the morton code (should have
    * enough capacity to store the interleaved binary word).
@@ -99,6 +190,23 @@ namespace DGtal
      */ 
     void interleaveBits(const Point  & aPoint, HashKey & output) const;
 
+    /**
+     * Interleaves the bits of an array of points (as interleaveBits).
+     * @param somePoints an array of @a n points.
+     * @param someKeys an array of @a n codes (output).
+     * @param n the number of points.
+     */
+    void encode(const Point * somePoints, HashKey * someKeys, const std::size_t n) const;
+
+    /**
+     * Deinterleaves the bits of an array of codes (without the depth
+     * prefix of the hash tree keys).
+     * @param someKeys an array of @a n codes.
+     * @param somePoints an array of @a n points (output).
+     * @param n the number of codes.
+     */
+    void decode(const HashKey * someKeys, Point * somePoints, const std::size_t n) const;
+
 
     /**
      * Returns the key corresponding to the coordinates passed in the parameters.
@@ -149,9 +257,8 @@ namespace DGtal
     
   private: 
     
-    ///@todo Implements dilateMasks
-    //boost::array< HashKey,LOG2<sizeof(HashKey)*8>::VALUE> myDilateMasks;
-    //boost::array< HashKey,LOG2<sizeof(HashKey)*8>::VALUE> myContractMasks;
+    /// Bit spreading and compaction of the coordinates
+    detail::MortonBits<HashKey, TPoint::dimension> myBits;
   };
 } // namespace DGtal
 
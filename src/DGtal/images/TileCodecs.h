@@ -0,0 +1,194 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file TileCodecs.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module TileCodecs.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(TileCodecs_RECURSES)
+#error Recursive header files inclusion detected in TileCodecs.h
+#else // defined(TileCodecs_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define TileCodecs_RECURSES
+
+#if !defined TileCodecs_h
+/** Prevents repeated inclusion of headers. */
+#define TileCodecs_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <cstddef>
+#include <boost/type_traits.hpp>
+#include "DGtal/base/Common.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /**
+   * Codecs compressing the values of the tiles of
+   * ImageContainerByCompressedTiles. A codec provides the static
+   * methods:
+   * - encode( values, n, code ): compresses the @a n values of
+   *   @a values into the bytes of the vector @a code;
+   * - decode( code, values, n ): writes the @a n values compressed
+   *   in the bytes starting at @a code into @a values;
+   * - at( code, n, i ): returns the @a i-th of the @a n values
+   *   compressed in the bytes starting at @a code;
+   *
+   * and the constant randomAccess, 'true' if at() reads a value
+   * without decoding the whole tile.
+   *
+   * The values are compressed as they are stored in memory (native
+   * byte order): the codes are not meant to be written to files.
+   */
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class RLETileCodec
+  /**
+   * Description of template class 'RLETileCodec' <p>
+   * @brief Aim: Run length encoding of the values of a tile, for
+   * label images: the code is the sequence of the (length, value)
+   * pairs of the runs of equal values.
+   *
+   * at() scans the runs.
+   *
+   * @tparam TValue type of values.
+   */
+  template <typename TValue>
+  struct RLETileCodec
+  {
+    typedef TValue Value;
+    BOOST_STATIC_CONSTANT( bool, randomAccess = true );
+
+    static void encode( const Value * someValues, std::size_t n,
+                        std::vector<unsigned char> & aCode );
+    static void decode( const unsigned char * aCode,
+                        Value * someValues, std::size_t n );
+    static Value at( const unsigned char * aCode,
+                     std::size_t n, std::size_t i );
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BitPackingTileCodec
+  /**
+   * Description of template class 'BitPackingTileCodec' <p>
+   * @brief Aim: Bit packing of the values of a tile, for binary
+   * images or images with a few consecutive values: each value is
+   * stored as its difference to the minimum value of the tile, with
+   * the number of bits of the largest difference (1 bit per value for
+   * a binary tile, no bit for a constant tile).
+   *
+   * at() is in O(1).
+   *
+   * @tparam TValue an integral type of values.
+   */
+  template <typename TValue>
+  struct BitPackingTileCodec
+  {
+    typedef TValue Value;
+    BOOST_STATIC_CONSTANT( bool, randomAccess = true );
+    BOOST_STATIC_ASSERT(( boost::is_integral<Value>::value ));
+
+    static void encode( const Value * someValues, std::size_t n,
+                        std::vector<unsigned char> & aCode );
+    static void decode( const unsigned char * aCode,
+                        Value * someValues, std::size_t n );
+    static Value at( const unsigned char * aCode,
+                     std::size_t n, std::size_t i );
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class LZTileCodec
+  /**
+   * Description of template class 'LZTileCodec' <p>
+   * @brief Aim: Byte oriented LZ77 compression of the values of a
+   * tile, in the spirit of LZ4: the bytes are a sequence of literals
+   * and of copies of at least 4 previous bytes found with a hash
+   * table. Suited to repetitive patterns that are not runs (e.g.
+   * periodic structures or smooth gray levels).
+   *
+   * at() decodes the whole tile: access the values through
+   * ImageContainerByCompressedTiles::getValues() or a tiled image.
+   *
+   * @tparam TValue type of values.
+   */
+  template <typename TValue>
+  struct LZTileCodec
+  {
+    typedef TValue Value;
+    BOOST_STATIC_CONSTANT( bool, randomAccess = false );
+
+    static void encode( const Value * someValues, std::size_t n,
+                        std::vector<unsigned char> & aCode );
+    static void decode( const unsigned char * aCode,
+                        Value * someValues, std::size_t n );
+    static Value at( const unsigned char * aCode,
+                     std::size_t n, std::size_t i );
+  };
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class AdaptiveTileCodec
+  /**
+   * Description of template class 'AdaptiveTileCodec' <p>
+   * @brief Aim: Compresses each tile with the codec giving the
+   * shortest code among RLETileCodec, LZTileCodec and (for integral
+   * values) BitPackingTileCodec. The first byte of the code tells the
+   * codec of the tile.
+   *
+   * The encoding runs the three codecs.
+   *
+   * @tparam TValue type of values.
+   */
+  template <typename TValue>
+  struct AdaptiveTileCodec
+  {
+    typedef TValue Value;
+    BOOST_STATIC_CONSTANT( bool, randomAccess = false );
+
+    static void encode( const Value * someValues, std::size_t n,
+                        std::vector<unsigned char> & aCode );
+    static void decode( const unsigned char * aCode,
+                        Value * someValues, std::size_t n );
+    static Value at( const unsigned char * aCode,
+                     std::size_t n, std::size_t i );
+  };
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/images/TileCodecs.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined TileCodecs_h
+
+#undef TileCodecs_RECURSES
+#endif // else defined(TileCodecs_RECURSES)
@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <algorithm>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ConceptUtils.h"
 #include "DGtal/images/CImage.h"
@@ -65,6 +66,14 @@ namespace DGtal
  * The third parameter is an alias on a write policy.
  * The fourth parameter is to set how many tiles we want for each dimension.
  * 
+ * The tiles have the same size (the extent of the domain divided by
+ * the number of tiles, rounded up), the last tile along a dimension
+ * being cropped to the domain.
+ * 
+ * With a write-back policy, the modified tiles are written to the
+ * underlying image when they leave the cache, when flush() is called
+ * and at the destruction of the tiled image.
+ * 
  *
  * @tparam TImageContainer an image container type (model of CImage).
  * @tparam TImageFactoryFromImage an image factory type (model of CImageFactory).
@@ -120,14 +129,16 @@ public:
         myImageCache = new MyImageCache(myImageFactoryFromImage, aReadPolicy, aWritePolicy);
         
         for(typename ImageContainer::Domain::Integer i=0; i<ImageContainer::Domain::dimension; i++)
-          mySize[i] = (myImagePtr->domain().upperBound()[i]-myImagePtr->domain().lowerBound()[i]+1)/myN;
+          mySize[i] = (myImagePtr->domain().upperBound()[i]-myImagePtr->domain().lowerBound()[i]+myN)/myN;
     }
 
     /**
      * Destructor.
+     * The cache is flushed before being deleted.
      */
     ~TiledImageFromImage()
     {
+        flush();
         delete myImageCache;
     }
 
@@ -136,6 +147,15 @@ public:
 
     /////////////////// Domains //////////////////
 
+    /**
+     * Returns a reference to the underlying image domain.
+     *
+     * @return a reference to the domain.
+     */
+    const Domain & domain() const
+    {
+      return myImagePtr->domain();
+    }
 
     /////////////////// Accessors //////////////////
 
@@ -169,18 +189,14 @@ public:
       
       typename ImageContainer::Domain::Integer i;
       
-      Point low;
-      for(i=0; i<ImageContainer::Domain::dimension; i++)
-      {
-        low[i] = aPoint[i]/mySize[i];
-        if (!(aPoint[i]%mySize[i])) low[i]--;
-      }
+      const Point & lowerBound = myImagePtr->domain().lowerBound();
+      const Point & upperBound = myImagePtr->domain().upperBound();
       
       Point dMin, dMax;
       for(i=0; i<ImageContainer::Domain::dimension; i++)
       {
-        dMin[i] = (low[i]*mySize[i])+1;
-        dMax[i] = (low[i]*mySize[i])+mySize[i];
+        dMin[i] = lowerBound[i] + ((aPoint[i]-lowerBound[i])/mySize[i])*mySize[i];
+        dMax[i] = std::min(dMin[i]+mySize[i]-1, upperBound[i]);
       }
       
       Domain di = Domain(dMin, dMax);
@@ -230,6 +246,25 @@ public:
           myImageCache->write(aPoint, aValue);
         }
     }
+    
+    /**
+     * Flush the cache: the tiles of the cache are written to the
+     * underlying image according to the write policy and removed
+     * from the cache.
+     */
+    void flush()
+    {
+        myImageCache->clearCache();
+    }
+
+    /**
+     * @return the cache of the tiles (e.g. for its hit and miss
+     * counters).
+     */
+    const MyImageCache & imageCache() const
+    {
+        return *myImageCache;
+    }
 
     // ------------------------- Protected Datas ------------------------------
 private:
@@ -245,18 +245,18 @@ static void draw( DGtal::Board2D & board, const DGtal::HyperRectDomain<TSpace> &
     
     
 // ImageContainerByHashTree
-template <typename C, typename Domain, typename Value, typename HashKey>
+template <typename C, typename Domain, typename Value, typename HashKey, typename Storage>
 static void drawImageRecursive( DGtal::Board2D & aBoard, 
-                         const DGtal::experimental::ImageContainerByHashTree<Domain, Value, HashKey> & i,
+                         const DGtal::experimental::ImageContainerByHashTree<Domain, Value, HashKey, Storage> & i,
                          HashKey key,
                          const double p[2],
                          const double len,
                          LibBoard::Board & board,
                          const C& cmap );
 
-template <typename C, typename Domain, typename Value, typename HashKey>
+template <typename C, typename Domain, typename Value, typename HashKey, typename Storage>
 static void drawImageHashTree( Board2D & board,
-                const DGtal::experimental::ImageContainerByHashTree<Domain, Value, HashKey> &,
+                const DGtal::experimental::ImageContainerByHashTree<Domain, Value, HashKey, Storage> &,
                 const Value &, const Value & );
 // ImageContainerByHashTree
 
@@ -68,6 +68,94 @@ namespace DGtal
   template<Dimension dim, typename Container>
   std::bitset<dim> setDimensionsNotIn( const Container &dimensions );
 
+  namespace detail
+  {
+    /**
+     * Description of class 'PointVectorOperations' <p>
+     * \brief Aim: Component-wise operations of PointVector on its
+     * container, i.e. the arithmetic and comparison operators of
+     * PointVector.
+     *
+     * This generic version loops over the components. It may be
+     * specialized for containers with a specific layout (see
+     * SIMDArray).
+     *
+     * @tparam TContainer the container of the PointVector components.
+     */
+    template <typename TContainer>
+    struct PointVectorOperations
+    {
+      /// a += b
+      static void add( TContainer & a, const TContainer & b )
+      {
+        for ( std::size_t i = 0; i < a.size(); ++i )
+          a[ i ] += b[ i ];
+      }
+
+      /// a -= b
+      static void sub( TContainer & a, const TContainer & b )
+      {
+        for ( std::size_t i = 0; i < a.size(); ++i )
+          a[ i ] -= b[ i ];
+      }
+
+      /// a = -a
+      static void negate( TContainer & a )
+      {
+        for ( std::size_t i = 0; i < a.size(); ++i )
+          a[ i ] = - a[ i ];
+      }
+
+      /// a = inf( a, b )
+      static void inf( TContainer & a, const TContainer & b )
+      {
+        for ( std::size_t i = 0; i < a.size(); ++i )
+          if ( b[ i ] < a[ i ] )
+            a[ i ] = b[ i ];
+      }
+
+      /// a = sup( a, b )
+      static void sup( TContainer & a, const TContainer & b )
+      {
+        for ( std::size_t i = 0; i < a.size(); ++i )
+          if ( a[ i ] < b[ i ] )
+            a[ i ] = b[ i ];
+      }
+
+      /// @return 'true' if a[i] <= b[i] for all i.
+      static bool isLower( const TContainer & a, const TContainer & b )
+      {
+        for ( std::size_t i = 0; i < a.size(); ++i )
+          if ( b[ i ] < a[ i ] )
+            return false;
+        return true;
+      }
+
+      /// @return the dot product of a and b.
+      static typename TContainer::value_type
+      dot( const TContainer & a, const TContainer & b )
+      {
+        typename TContainer::value_type r =
+          NumberTraits<typename TContainer::value_type>::ZERO;
+        for ( std::size_t i = 0; i < a.size(); ++i )
+          r += a[ i ] * b[ i ];
+        return r;
+      }
+
+      /// @return 'true' if a == b.
+      static bool equal( const TContainer & a, const TContainer & b )
+      {
+        return a == b;
+      }
+
+      /// @return 'true' if a is lexicographically lower than b.
+      static bool less( const TContainer & a, const TContainer & b )
+      {
+        return a < b;
+      }
+    };
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // class PointVector
   /**
@@ -97,7 +185,8 @@ namespace DGtal
    * @tparam TContainer specifies the container to be used to store
    * the point coordinates. At this point, such container must be a
    * random access bidirectionnal a-la STL containers (e.g. vector,
-   * boost/array).
+   * boost/array). SIMDArray is such a container whose arithmetic and
+   * comparison operators use SSE/AVX instructions.
    *
    *
    * If TEuclideanRing is a Integer type (built-in integers,
@@ -0,0 +1,264 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file SIMDArray.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module SIMDArray.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(SIMDArray_RECURSES)
+#error Recursive header files inclusion detected in SIMDArray.h
+#else // defined(SIMDArray_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define SIMDArray_RECURSES
+
+#if !defined SIMDArray_h
+/** Prevents repeated inclusion of headers. */
+#define SIMDArray_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cstddef>
+#include <iterator>
+#include <algorithm>
+#include <boost/static_assert.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class SIMDArray
+  /**
+   * Description of template class 'SIMDArray' <p>
+   * \brief Aim: A fixed size array of at most 4 components, to be
+   * used as the container of a PointVector, whose arithmetic and
+   * comparison operators use SIMD instructions.
+   *
+   * The operators of PointVector (+, -, inf, sup, isLower, dot, ==
+   * and the lexicographic <) process all the components at once with
+   * SSE2, SSE4 or AVX2 instructions for DGtal::int32_t and
+   * DGtal::int64_t components, as enabled by the compiler flags (e.g.
+   * -msse4.2 or -march=native). Other component types, or a target
+   * without SSE2, fall back to loops.
+   *
+   * The components are not padded: the layout is the one of
+   * boost::array (e.g. 12 bytes for 3 x int32). The registers are
+   * filled component by component, so that they are forwarded from
+   * preceding single component writes. Hence, code that mostly reads
+   * and writes single components (HyperRectDomain iteration,
+   * MetricAdjacency::writeNeighbors) runs at the speed of
+   * boost::array (within 10% on int32, faster on int64), while whole
+   * point operations are faster (about 2x for bounding boxes, 1.2x
+   * for sorting; see testSIMDArray-benchmark.cpp).
+   *
+   * This container is opt-in, through the container parameter of
+   * PointVector or SpaceND:
+   * @code
+   * typedef SpaceND<3, DGtal::int32_t, SIMDArray<DGtal::int32_t, 3> > Space;
+   * typedef HyperRectDomain<Space> Domain;
+   * typedef Space::Point Point;
+   * @endcode
+   *
+   * The interface is the one of boost::array.
+   *
+   * @tparam T the type of the components.
+   * @tparam N the number of components (1 to 4).
+   *
+   * @see testSIMDArray.cpp, testSIMDArray-benchmark.cpp
+   */
+  template <typename T, std::size_t N>
+  class SIMDArray
+  {
+    BOOST_STATIC_ASSERT(( N >= 1 && N <= 4 ));
+
+    // ----------------------- Types ------------------------------
+  public:
+    typedef T value_type;
+    typedef T * iterator;
+    typedef const T * const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef T & reference;
+    typedef const T & const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    iterator begin() { return myValues; }
+    const_iterator begin() const { return myValues; }
+    iterator end() { return myValues + N; }
+    const_iterator end() const { return myValues + N; }
+
+    reverse_iterator rbegin() { return reverse_iterator( end() ); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator( end() ); }
+    reverse_iterator rend() { return reverse_iterator( begin() ); }
+    const_reverse_iterator rend() const { return const_reverse_iterator( begin() ); }
+
+    reference operator[]( size_type i )
+    {
+      ASSERT( i < N );
+      return myValues[ i ];
+    }
+    const_reference operator[]( size_type i ) const
+    {
+      ASSERT( i < N );
+      return myValues[ i ];
+    }
+
+    static size_type size() { return N; }
+    static bool empty() { return false; }
+    static size_type max_size() { return N; }
+
+    /**
+     * @return a pointer on the components.
+     */
+    T * data() { return myValues; }
+    /**
+     * @return a pointer on the components.
+     */
+    const T * data() const { return myValues; }
+
+    /**
+     * Assigns @a value to all the components.
+     * @param value any value.
+     */
+    void fill( const T & value )
+    {
+      std::fill( begin(), end(), value );
+    }
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The components.
+    T myValues[ N ];
+
+  }; // end of class SIMDArray
+
+  /// @return 'true' if the components of @a a and @a b are equal.
+  template <typename T, std::size_t N>
+  bool operator==( const SIMDArray<T,N> & a, const SIMDArray<T,N> & b );
+
+  /// @return 'true' if a component of @a a and @a b differs.
+  template <typename T, std::size_t N>
+  bool operator!=( const SIMDArray<T,N> & a, const SIMDArray<T,N> & b );
+
+  /// @return 'true' if @a a is lexicographically lower than @a b.
+  template <typename T, std::size_t N>
+  bool operator<( const SIMDArray<T,N> & a, const SIMDArray<T,N> & b );
+
+  /// @return 'true' if @a b is lexicographically lower than @a a.
+  template <typename T, std::size_t N>
+  bool operator>( const SIMDArray<T,N> & a, const SIMDArray<T,N> & b );
+
+  /// @return 'true' if @a b is not lexicographically lower than @a a.
+  template <typename T, std::size_t N>
+  bool operator<=( const SIMDArray<T,N> & a, const SIMDArray<T,N> & b );
+
+  /// @return 'true' if @a a is not lexicographically lower than @a b.
+  template <typename T, std::size_t N>
+  bool operator>=( const SIMDArray<T,N> & a, const SIMDArray<T,N> & b );
+
+  namespace detail
+  {
+    /**
+     * Operations on the @a L components of a SIMDArray, with loops. The
+     * specializations for DGtal::int32_t and DGtal::int64_t (see
+     * SIMDArray.ih) use SSE/AVX instructions.
+     *
+     * @tparam T the type of the components.
+     * @tparam L the number of components.
+     */
+    template <typename T, std::size_t L>
+    struct SIMDLanes;
+
+    /**
+     * Specialization of PointVectorOperations for SIMDArray: the
+     * operations process all the components with SIMDLanes.
+     */
+    template <typename T, std::size_t N>
+    struct PointVectorOperations< SIMDArray<T,N> >
+    {
+      typedef SIMDArray<T,N> Container;
+      typedef SIMDLanes<T, N> Lanes;
+
+      static void add( Container & a, const Container & b )
+      {
+        Lanes::add( a.data(), b.data() );
+      }
+      static void sub( Container & a, const Container & b )
+      {
+        Lanes::sub( a.data(), b.data() );
+      }
+      static void negate( Container & a )
+      {
+        Lanes::negate( a.data() );
+      }
+      static void inf( Container & a, const Container & b )
+      {
+        Lanes::inf( a.data(), b.data() );
+      }
+      static void sup( Container & a, const Container & b )
+      {
+        Lanes::sup( a.data(), b.data() );
+      }
+      static bool isLower( const Container & a, const Container & b )
+      {
+        return Lanes::isLower( a.data(), b.data() );
+      }
+      static T dot( const Container & a, const Container & b )
+      {
+        return Lanes::dot( a.data(), b.data() );
+      }
+      static bool equal( const Container & a, const Container & b )
+      {
+        return std::equal( a.begin(), a.end(), b.begin() );
+      }
+      static bool less( const Container & a, const Container & b )
+      {
+        return Lanes::less( a.data(), b.data() );
+      }
+    };
+  } // namespace detail
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/SIMDArray.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined SIMDArray_h
+
+#undef SIMDArray_RECURSES
+#endif // else defined(SIMDArray_RECURSES)
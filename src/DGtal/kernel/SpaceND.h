@@ -43,6 +43,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <boost/array.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/PointVector.h"
@@ -68,6 +69,9 @@ namespace DGtal
    * @tparam TInteger specifies the integer number type to use as a
    * ring for the computations or as coordinates type. Integer must be
    * a model of CInteger and CSignedInteger concepts.  
+   * @tparam TPointContainer specifies the container of the Point and
+   * Vector coordinates (see PointVector), e.g. SIMDArray for SIMD
+   * point operators.
    * 
    * Example of use:
    *@code
@@ -91,7 +95,8 @@ Point4Int a= {2, 3 , -5 , 6};
    **/
 
   template < Dimension dim,
-	     typename TInteger = DGtal::int32_t >
+	     typename TInteger = DGtal::int32_t,
+	     typename TPointContainer = boost::array<TInteger, dim> >
   class SpaceND
   {
     //Integer must be a model of the concept CInteger.
@@ -107,10 +112,10 @@ Point4Int a= {2, 3 , -5 , 6};
     typedef UnsignedInteger Size;
      
     ///Points in DGtal::SpaceND.
-    typedef PointVector<dim,Integer> Point;
+    typedef PointVector<dim,Integer,TPointContainer> Point;
   
     ///Vectors in DGtal::SpaceND.
-    typedef PointVector<dim,Integer> Vector;
+    typedef PointVector<dim,Integer,TPointContainer> Vector;
     
     ///Point with "double" as  coordinate type with the same dimension
     ///as SpaceND.
@@ -121,7 +126,7 @@ Point4Int a= {2, 3 , -5 , 6};
     typedef PointVector<dim, double> RealVector;
 
     ///Type to denote the space itself.
-    typedef SpaceND<dim, Integer> Space;
+    typedef SpaceND<dim, Integer, TPointContainer> Space;
     /// Defined for convenience (same as Space).
     typedef Space Self;
 
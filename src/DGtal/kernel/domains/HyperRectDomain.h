@@ -500,6 +500,24 @@ namespace DGtal
       return res; 
     }
 
+    /**
+     * @return the number of rows of the domain, i.e. of its segments
+     * parallel to the first axis (0 for an empty domain).
+     */
+    Size nbRows() const;
+
+    /**
+     * @return the number of points of a row.
+     */
+    Size rowLength() const;
+
+    /**
+     * @param aRow a row index in [0, nbRows()), the rows being
+     * numbered in the order of the domain iterator.
+     * @return the first point of the row @a aRow.
+     */
+    Point rowStart( Size aRow ) const;
+
     /**
      * Returns the lowest point of the space diagonal.
      *
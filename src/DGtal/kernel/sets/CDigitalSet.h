@@ -125,7 +125,8 @@ namespace DGtal
     
  ### Models
 
-- DigitalSetBySTLVector, DigitalSetBySTLSet, DigitalSetFromMap
+- DigitalSetBySTLVector, DigitalSetBySTLSet, DigitalSetFromMap, DigitalSetByBitVector,
+  DigitalSetByHashSet, DigitalSetByRuns
     
  ### Notes
 
@@ -0,0 +1,445 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByBitVector.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module DigitalSetByBitVector.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByBitVector_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByBitVector.h
+#else // defined(DigitalSetByBitVector_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByBitVector_RECURSES
+
+#if !defined DigitalSetByBitVector_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByBitVector_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByBitVector
+  /**
+   * Description of template class 'DigitalSetByBitVector' <p> \brief
+   * Aim: Realizes the concept CDigitalSet by storing one bit per point
+   * of a rectangular domain.
+   *
+   * The bits are those of 64 bits words, in the order of the points
+   * in the domain (the first coordinate varying first, as in
+   * ImageContainerBySTLVector). Insertion, erasure and belonging test
+   * are in O(1) and the memory is one bit per point of the domain,
+   * whatever the size of the set: this model is suited to big sets
+   * (dense in their domain) that are often modified.
+   *
+   * The iterators skip the empty words and visit the points in the
+   * order of the domain. Erasing a point does not invalidate the
+   * iterators. The complement and the union (operator+=), intersection
+   * (operator*=) and difference (operator-=) with a set of the same
+   * domain are computed word by word.
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @see CDigitalSet, DigitalSetSelector
+   */
+  template <typename TDomain>
+  class DigitalSetByBitVector
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByBitVector<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain, HyperRectDomain<Space> >::value ));
+
+    /// Type of the words storing the bits
+    typedef DGtal::uint64_t Word;
+
+    /**
+     * Bidirectional iterator on the points of the set, in the order
+     * of the domain.
+     */
+    class ConstIterator
+      : public boost::iterator_facade< ConstIterator, Point const,
+                                       boost::bidirectional_traversal_tag >
+    {
+    public:
+      ConstIterator();
+      ConstIterator( const Self * aSet, Size anIndex );
+
+    private:
+      friend class boost::iterator_core_access;
+      void increment();
+      void decrement();
+      bool equal( const ConstIterator & other ) const;
+      const Point & dereference() const;
+
+      /// Sets the index and the current point
+      void moveTo( Size anIndex );
+
+      /// The set
+      const Self * mySet;
+      /// Position of the point in the domain
+      Size myIndex;
+      /// The current point
+      Point myPoint;
+
+      friend class DigitalSetByBitVector<TDomain>;
+    };
+
+    typedef ConstIterator Iterator;
+    friend class ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByBitVector();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByBitVector( const Domain & d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByBitVector ( const DigitalSetByBitVector & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByBitVector & operator= ( const DigitalSetByBitVector & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set (O(1)).
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set. Same as insert.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. Same as insert.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set. The iterators
+     * remain valid.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return an iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * set union to left.
+     * @param aSet any other set.
+     */
+    Self & operator+=( const Self & aSet );
+
+    /**
+     * set intersection to left.
+     * @param aSet any other set.
+     */
+    Self & operator*=( const Self & aSet );
+
+    /**
+     * set difference to left.
+     * @param aSet any other set.
+     */
+    Self & operator-=( const Self & aSet );
+
+    // ----------------------- Model of CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const Self & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain.
+     */
+    const Domain & myDomain;
+
+    /**
+     * The extent of the domain.
+     */
+    Point myExtent;
+
+    /**
+     * The number of points of the domain.
+     */
+    Size myNbBits;
+
+    /**
+     * The bits of the points of the domain.
+     */
+    std::vector<Word> myWords;
+
+    /**
+     * The number of points of the set.
+     */
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByBitVector();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param p a point of the domain.
+     * @return its position in the domain.
+     */
+    Size index( const Point & p ) const;
+
+    /**
+     * @param anIndex a position in the domain.
+     * @return the point at this position.
+     */
+    Point point( Size anIndex ) const;
+
+    /**
+     * @param anIndex a position in the domain (or its size).
+     * @return the position of the first point of the set from @a
+     * anIndex, or the size of the domain if there is none.
+     */
+    Size next( Size anIndex ) const;
+
+    /**
+     * @param anIndex a position in the domain.
+     * @return the position of the last point of the set up to @a
+     * anIndex.
+     * @pre there is such a point.
+     */
+    Size previous( Size anIndex ) const;
+
+    /**
+     * @param aSet another set.
+     * @return 'true' if the domain of @a aSet has the same bounds.
+     */
+    bool sameDomain( const Self & aSet ) const;
+
+    /**
+     * Clears the bits after the last point of the domain, and counts
+     * the points of the set.
+     */
+    void update();
+
+  }; // end of class DigitalSetByBitVector
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByBitVector'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByBitVector' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalSetByBitVector<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByBitVector.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByBitVector_h
+
+#undef DigitalSetByBitVector_RECURSES
+#endif // else defined(DigitalSetByBitVector_RECURSES)
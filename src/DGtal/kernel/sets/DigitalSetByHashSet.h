@@ -0,0 +1,471 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByHashSet.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module DigitalSetByHashSet.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByHashSet_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByHashSet.h
+#else // defined(DigitalSetByHashSet_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByHashSet_RECURSES
+
+#if !defined DigitalSetByHashSet_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByHashSet_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include <iterator>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/domains/CDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByHashSet
+  /**
+   * Description of template class 'DigitalSetByHashSet' <p> \brief
+   * Aim: Realizes the concept CDigitalSet with an open addressing hash
+   * table of the points, for sparse sets in huge domains.
+   *
+   * Each point is stored as a 64 bits key packing its coordinates
+   * relative to the lower bound of the domain (the first coordinate
+   * in the lowest bits), so that the domain may have up to 2^63
+   * points. The keys are in a table whose capacity is a power of two,
+   * searched by linear probing from a multiplicative hash of the key;
+   * the table grows when it is 70% full. Insertion, erasure and
+   * belonging test are in O(1) on average, and the memory is 8 bytes
+   * per slot, i.e. 12 to 23 bytes per point.
+   *
+   * The iterators visit the points in the order of the table, which
+   * depends on the history of the insertions: use exportSorted() for
+   * a reproducible order (the order of the domain). Erasing a point
+   * does not invalidate the iterators, inserting a point does.
+   *
+   * computeComplement() and assignFromComplement() scan the whole
+   * domain.
+   *
+   * @tparam TDomain a realization of the concept CDomain.
+   * @see CDigitalSet, DigitalSetSelector
+   */
+  template <typename TDomain>
+  class DigitalSetByHashSet
+  {
+  public:
+    BOOST_CONCEPT_ASSERT(( CDomain<TDomain> ));
+    typedef TDomain Domain;
+    typedef DigitalSetByHashSet<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+
+    /// Type of the packed points
+    typedef DGtal::uint64_t Key;
+
+    /**
+     * Bidirectional iterator on the points of the set, in the order
+     * of the table.
+     */
+    class ConstIterator
+      : public boost::iterator_facade< ConstIterator, Point const,
+                                       boost::bidirectional_traversal_tag >
+    {
+    public:
+      ConstIterator();
+      ConstIterator( const Self * aSet, std::size_t aSlot );
+
+    private:
+      friend class boost::iterator_core_access;
+      void increment();
+      void decrement();
+      bool equal( const ConstIterator & other ) const;
+      const Point & dereference() const;
+
+      /// Sets the slot and the current point
+      void moveTo( std::size_t aSlot );
+
+      /// The set
+      const Self * mySet;
+      /// Slot of the point in the table
+      std::size_t mySlot;
+      /// The current point
+      Point myPoint;
+
+      friend class DigitalSetByHashSet<TDomain>;
+    };
+
+    typedef ConstIterator Iterator;
+    friend class ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByHashSet();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     * @pre the packed coordinates of the points of [d] fit in 63 bits.
+     */
+    DigitalSetByHashSet( const Domain & d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByHashSet ( const DigitalSetByHashSet & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByHashSet & operator= ( const DigitalSetByHashSet & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Prepares the table for @a n points, so that inserting them does
+     * not grow it.
+     *
+     * @param n a number of points.
+     */
+    void reserve( Size n );
+
+    /**
+     * Adds point [p] to this set.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. With forward iterators, the table is first reserved
+     * for all the points.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set. Same as insert.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. Same as insert.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set. The iterators
+     * remain valid.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set (the capacity of the table is kept).
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return an iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * set union to left.
+     * @param aSet any other set.
+     */
+    Self & operator+=( const Self & aSet );
+
+    // ----------------------- Model of CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Writes the points of the set in the order of the domain (the
+     * first coordinate varying first), whatever the order of their
+     * insertions.
+     *
+     * @param out an output iterator on Point.
+     * @tparam TOutputIterator a model of output iterator.
+     */
+    template <typename TOutputIterator>
+    void exportSorted( TOutputIterator out ) const;
+
+    /**
+     * Computes the complement in the domain of this set (scans the
+     * domain).
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this (scans the domain).
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const Self & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /// Key of the empty slots
+    static const Key EMPTY = ~Key( 0 );
+
+    /// Key of the slots whose point was erased
+    static const Key ERASED = ~Key( 0 ) - 1;
+
+    /**
+     * The associated domain.
+     */
+    const Domain & myDomain;
+
+    /**
+     * Position of the bits of each coordinate in the keys.
+     */
+    unsigned int myShifts[ Space::dimension ];
+
+    /**
+     * Mask of the bits of each coordinate (once shifted).
+     */
+    Key myMasks[ Space::dimension ];
+
+    /**
+     * The table of keys (EMPTY, ERASED or a point).
+     */
+    std::vector<Key> mySlots;
+
+    /**
+     * Number of bits of the capacity of the table.
+     */
+    unsigned int myLogCapacity;
+
+    /**
+     * The number of points of the set.
+     */
+    Size mySize;
+
+    /**
+     * The number of slots that are not EMPTY.
+     */
+    std::size_t myNbUsed;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByHashSet();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /// @return the key of a point of the domain.
+    Key key( const Point & p ) const;
+
+    /// @return the point of a key.
+    Point point( Key aKey ) const;
+
+    /// @return the first slot to search for a key.
+    std::size_t hash( Key aKey ) const;
+
+    /// @return the slot of a key, or the capacity if absent.
+    std::size_t slot( Key aKey ) const;
+
+    /// @return the first used slot from @a aSlot, or the capacity.
+    std::size_t next( std::size_t aSlot ) const;
+
+    /// @return the last used slot up to @a aSlot. @pre there is one.
+    std::size_t previous( std::size_t aSlot ) const;
+
+    /// Moves the keys to a table of 2^@a aLogCapacity slots.
+    void rehash( unsigned int aLogCapacity );
+
+    /// @return 'true' if @a n used slots exceed the maximal load.
+    bool overloaded( std::size_t n ) const;
+
+    /// @return the number of bits of the smallest capacity for @a n points.
+    static unsigned int logCapacity( std::size_t n );
+
+    /// Bulk insertion of forward iterators.
+    template <typename PointIterator>
+    void insert( PointIterator first, PointIterator last,
+                 std::forward_iterator_tag );
+
+    /// Bulk insertion of input iterators.
+    template <typename PointIterator>
+    void insert( PointIterator first, PointIterator last,
+                 std::input_iterator_tag );
+
+  }; // end of class DigitalSetByHashSet
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByHashSet'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByHashSet' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalSetByHashSet<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByHashSet.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByHashSet_h
+
+#undef DigitalSetByHashSet_RECURSES
+#endif // else defined(DigitalSetByHashSet_RECURSES)
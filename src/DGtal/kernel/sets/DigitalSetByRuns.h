@@ -0,0 +1,560 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetByRuns.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module DigitalSetByRuns.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetByRuns_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetByRuns.h
+#else // defined(DigitalSetByRuns_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetByRuns_RECURSES
+
+#if !defined DigitalSetByRuns_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetByRuns_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <string>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/sets/DigitalSetHelper.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSetByRuns
+  /**
+   * Description of template class 'DigitalSetByRuns' <p> \brief
+   * Aim: Realizes the concept CDigitalSet by storing the runs of the
+   * set, i.e. its maximal sequences of consecutive points along
+   * dimension 0, in the order of the domain.
+   *
+   * A run is 16 bytes for a 3D set of int: compact sets (balls,
+   * smooth shapes, segmented objects) take a few bytes per row of the
+   * domain instead of tens of bytes per point.
+   *
+   * Inserting the points in the order of the domain appends to the
+   * last run in O(1): Shapes::digitalShaper and SetFromImage build
+   * the set row by row without any search. Other insertions and
+   * erasures are in O(log r + r) where r is the number of runs, the
+   * belonging test is in O(log r). The iterators visit the points in
+   * the order of the domain and are invalidated by any modification.
+   *
+   * Union (operator+=), intersection (operator*=), difference
+   * (operator-=) and complement merge the runs in linear time in the
+   * number of runs, and dilate and erode compute the morphological
+   * operations by a structuring element with one merge per run of the
+   * structuring element.
+   *
+   * Conversions from and to the other models of CDigitalSet are
+   * done with DigitalSetConverter or insert( first, last ), which
+   * sorts unordered ranges before building their runs.
+   *
+   * @tparam TDomain a HyperRectDomain.
+   * @see CDigitalSet, DigitalSetByBitVector
+   */
+  template <typename TDomain>
+  class DigitalSetByRuns
+  {
+  public:
+    typedef TDomain Domain;
+    typedef DigitalSetByRuns<Domain> Self;
+    typedef typename Domain::Space Space;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef typename Point::Coordinate Coordinate;
+
+    /// domain should be rectangular
+    BOOST_STATIC_ASSERT(( boost::is_same< Domain, HyperRectDomain<Space> >::value ));
+
+    /// Index of a row of the domain (the points with the same
+    /// coordinates but the first one)
+    typedef DGtal::uint64_t RowIndex;
+
+    /**
+     * Maximal sequence of consecutive points of the set along
+     * dimension 0.
+     */
+    struct Run
+    {
+      /// Row of the run
+      RowIndex row;
+      /// First coordinate of the first point
+      Coordinate first;
+      /// First coordinate of the last point
+      Coordinate last;
+
+      /// Order of the domain: by row, then by first point.
+      bool operator<( const Run & other ) const
+      {
+        return ( row < other.row ) || ( ( row == other.row ) && ( first < other.first ) );
+      }
+    };
+
+    /// Container of the runs
+    typedef std::vector<Run> Runs;
+
+    /**
+     * Bidirectional iterator on the points of the set, in the order
+     * of the domain.
+     */
+    class ConstIterator
+      : public boost::iterator_facade< ConstIterator, Point const,
+                                       boost::bidirectional_traversal_tag >
+    {
+    public:
+      ConstIterator();
+      ConstIterator( const Self * aSet, std::size_t aRun );
+      ConstIterator( const Self * aSet, std::size_t aRun, const Point & aPoint );
+
+    private:
+      friend class boost::iterator_core_access;
+      void increment();
+      void decrement();
+      bool equal( const ConstIterator & other ) const;
+      const Point & dereference() const;
+
+      /// The set
+      const Self * mySet;
+      /// Position of the current run
+      std::size_t myRun;
+      /// The current point
+      Point myPoint;
+
+      friend class DigitalSetByRuns<TDomain>;
+    };
+
+    typedef ConstIterator Iterator;
+    friend class ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSetByRuns();
+
+    /**
+     * Constructor.
+     * Creates the empty set in the domain [d].
+     *
+     * @param d any domain.
+     */
+    DigitalSetByRuns( const Domain & d );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    DigitalSetByRuns ( const DigitalSetByRuns & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    DigitalSetByRuns & operator= ( const DigitalSetByRuns & other );
+
+    /**
+     * @return the embedding domain.
+     */
+    const Domain & domain() const;
+
+    /**
+     * @return the runs of the set, in the order of the domain.
+     */
+    const Runs & runs() const;
+
+    // ----------------------- Standard Set services --------------------------
+  public:
+
+    /**
+     * @return the number of elements in the set (O(1)).
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' iff the set is empty (no element).
+     */
+    bool empty() const;
+
+    /**
+     * Adds point [p] to this set, in O(1) if [p] is after the last
+     * point of the set in the order of the domain.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insert( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. The points are sorted if they are not in the order of
+     * the domain, then their runs are merged with the runs of the set.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insert( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Adds point [p] to this set. Same as insert.
+     *
+     * @param p any digital point.
+     * @pre p should belong to the associated domain.
+     */
+    void insertNew( const Point & p );
+
+    /**
+     * Adds the collection of points specified by the two iterators to
+     * this set. Same as insert.
+     *
+     * @param first the start point in the collection of Point.
+     * @param last the last point in the collection of Point.
+     * @pre all points should belong to the associated domain.
+     */
+    template <typename PointInputIterator>
+    void insertNew( PointInputIterator first, PointInputIterator last );
+
+    /**
+     * Removes point [p] from the set.
+     *
+     * @param p the point to remove.
+     * @return the number of removed elements (0 or 1).
+     */
+    Size erase( const Point & p );
+
+    /**
+     * Removes the point pointed by [it] from the set.
+     *
+     * @param it an iterator on this set.
+     * @pre it should point on a valid element ( it != end() ).
+     */
+    void erase( Iterator it );
+
+    /**
+     * Removes the collection of points specified by the two iterators from
+     * this set.
+     *
+     * @param first the start point in this set.
+     * @param last the last point in this set.
+     */
+    void erase( Iterator first, Iterator last );
+
+    /**
+     * Clears the set.
+     * @post this set is empty.
+     */
+    void clear();
+
+    /**
+     * @param p any digital point.
+     * @return an iterator pointing on [p] if found, otherwise end().
+     */
+    ConstIterator find( const Point & p ) const;
+
+    /**
+     * @return a const iterator on the first element in this set.
+     */
+    ConstIterator begin() const;
+
+    /**
+     * @return a const iterator on the element after the last in this set.
+     */
+    ConstIterator end() const;
+
+    /**
+     * set union to left.
+     * @param aSet any other set.
+     */
+    Self & operator+=( const Self & aSet );
+
+    /**
+     * set intersection to left.
+     * @param aSet any other set.
+     */
+    Self & operator*=( const Self & aSet );
+
+    /**
+     * set difference to left.
+     * @param aSet any other set.
+     */
+    Self & operator-=( const Self & aSet );
+
+    // ----------------------- Model of CPointPredicate -----------------------------
+  public:
+
+    /**
+       @param p any point.
+       @return 'true' if and only if \a p belongs to this set.
+    */
+    bool operator()( const Point & p ) const;
+
+    // ----------------------- Other Set services -----------------------------
+  public:
+
+    /**
+     * Computes the complement in the domain of this set
+     * @param ito an output iterator
+     * @tparam TOutputIterator a model of output iterator
+     */
+    template< typename TOutputIterator >
+    void computeComplement(TOutputIterator& ito) const;
+
+    /**
+     * Builds the complement in the domain of the set [other_set] in
+     * this.
+     *
+     * @param other_set defines the set whose complement is assigned to 'this'.
+     */
+    void assignFromComplement( const Self & other_set );
+
+    /**
+     * Computes the bounding box of this set.
+     *
+     * @param lower the first point of the bounding box (lowest in all
+     * directions).
+     * @param upper the last point of the bounding box (highest in all
+     * directions).
+     */
+    void computeBoundingBox( Point & lower, Point & upper ) const;
+
+    /**
+     * Dilates this set by a structuring element: the set becomes the
+     * points p + v for all points p of the set and all vectors v of
+     * the structuring element that are in the domain.
+     *
+     * @param first the first vector of the structuring element.
+     * @param last the end of the structuring element.
+     * @tparam VectorInputIterator an input iterator on Vector.
+     */
+    template <typename VectorInputIterator>
+    void dilate( VectorInputIterator first, VectorInputIterator last );
+
+    /**
+     * Erodes this set by a structuring element: the set becomes the
+     * points p such that p + v belongs to the set for all vectors v
+     * of the structuring element.
+     *
+     * @param first the first vector of the structuring element.
+     * @param last the end of the structuring element.
+     * @tparam VectorInputIterator an input iterator on Vector.
+     * @pre the structuring element should not be empty.
+     */
+    template <typename VectorInputIterator>
+    void erode( VectorInputIterator first, VectorInputIterator last );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  protected:
+
+    /**
+     * The associated domain.
+     */
+    const Domain & myDomain;
+
+    /**
+     * The extent of the domain.
+     */
+    Point myExtent;
+
+    /**
+     * The number of rows of the domain.
+     */
+    RowIndex myNbRows;
+
+    /**
+     * The runs of the set, sorted, disjoint and not adjacent.
+     */
+    Runs myRuns;
+
+    /**
+     * The number of points of the set.
+     */
+    Size mySize;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Default Constructor.
+     * Forbidden since a Domain is necessary for defining a set.
+     */
+    DigitalSetByRuns();
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * @param p a point of the domain.
+     * @return the index of its row.
+     */
+    RowIndex row( const Point & p ) const;
+
+    /**
+     * Sets the coordinates but the first one of a point.
+     *
+     * @param p (modified) any point.
+     * @param aRow the index of a row of the domain.
+     */
+    void setRow( Point & p, RowIndex aRow ) const;
+
+    /**
+     * @param aRow the index of a row.
+     * @param x a first coordinate.
+     * @return the position of the run containing this point, or the
+     * number of runs.
+     */
+    std::size_t locate( RowIndex aRow, Coordinate x ) const;
+
+    /**
+     * Appends the runs of a set, translated by a vector and extended
+     * at their end, to runs of this domain. The runs are clipped to
+     * this domain.
+     *
+     * @param out (modified) runs in this domain.
+     * @param aSet any set, maybe this one.
+     * @param shift a translation.
+     * @param growth the number of points added at the end of the
+     * runs (or removed if negative).
+     */
+    void transform( Runs & out, const Self & aSet, const Vector & shift,
+                    Coordinate growth ) const;
+
+    /**
+     * Splits a structuring element into runs.
+     *
+     * @param first the first vector of the structuring element.
+     * @param last the end of the structuring element.
+     * @param origins (modified) the first vector of each run.
+     * @param lengths (modified) the number of vectors of each run.
+     */
+    template <typename VectorInputIterator>
+    static void structuringRuns( VectorInputIterator first, VectorInputIterator last,
+                                 std::vector<Vector> & origins,
+                                 std::vector<Coordinate> & lengths );
+
+    /**
+     * Appends a run to sorted runs, merging it with the last one if
+     * they overlap or are adjacent.
+     *
+     * @param out (modified) sorted runs.
+     * @param aRun a run after the last one of out.
+     */
+    static void append( Runs & out, const Run & aRun );
+
+    /**
+     * Union of sorted runs, in linear time.
+     */
+    static void unite( const Runs & a, const Runs & b, Runs & out );
+
+    /**
+     * Intersection of sorted runs, in linear time.
+     */
+    static void intersect( const Runs & a, const Runs & b, Runs & out );
+
+    /**
+     * Difference of sorted runs, in linear time.
+     */
+    static void subtract( const Runs & a, const Runs & b, Runs & out );
+
+    /**
+     * Complement of sorted runs in this domain, in linear time in the
+     * number of runs and of rows.
+     */
+    void complement( const Runs & a, Runs & out ) const;
+
+    /**
+     * @param aSet another set.
+     * @return 'true' if the domain of @a aSet has the same bounds.
+     */
+    bool sameDomain( const Self & aSet ) const;
+
+    /**
+     * Counts the points of the set.
+     */
+    void update();
+
+  }; // end of class DigitalSetByRuns
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSetByRuns'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSetByRuns' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Domain>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalSetByRuns<Domain> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetByRuns.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetByRuns_h
+
+#undef DigitalSetByRuns_RECURSES
+#endif // else defined(DigitalSetByRuns_RECURSES)
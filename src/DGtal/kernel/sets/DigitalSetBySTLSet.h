@@ -46,9 +46,13 @@
 // Inclusions
 #include <iostream>
 #include <set>
+#include <vector>
 #include <string>
+#include <boost/type_traits/is_same.hpp>
 #include "DGtal/base/Common.h"
+#include "DGtal/base/Executors.h"
 #include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/kernel/sets/DigitalSetHelper.h"
 //////////////////////////////////////////////////////////////////////////////
 
 //#include "DGtal/io/Display3D.h"
@@ -144,7 +148,8 @@ namespace DGtal
 
     /**
      * Adds the collection of points specified by the two iterators to
-     * this set.
+     * this set. The points are sorted first, so that each insertion
+     * is hinted by the previous one.
      *
      * @param first the start point in the collection of Point.
      * @param last the last point in the collection of Point.
@@ -246,6 +251,20 @@ namespace DGtal
     DigitalSetBySTLSet<Domain> & operator+=
     ( const DigitalSetBySTLSet<Domain> & aSet );
 
+    /**
+     * set intersection to left, by merging the two ordered sets.
+     * @param aSet any other set.
+     */
+    DigitalSetBySTLSet<Domain> & operator*=
+    ( const DigitalSetBySTLSet<Domain> & aSet );
+
+    /**
+     * set difference to left, by merging the two ordered sets.
+     * @param aSet any other set.
+     */
+    DigitalSetBySTLSet<Domain> & operator-=
+    ( const DigitalSetBySTLSet<Domain> & aSet );
+
     // ----------------------- Model of CPointPredicate -----------------------------
   public:
 
@@ -266,6 +285,21 @@ namespace DGtal
    template< typename TOutputIterator >
     void computeComplement(TOutputIterator& ito) const; 
 
+    /**
+     * Computes the complement in the domain of this set. For a
+     * HyperRectDomain, the domain slabs are scanned in parallel by
+     * @a anExecutor (see complementInDomain) and the points are
+     * output in the domain order.
+     *
+     * @param ito an output iterator
+     * @param anExecutor the executor scanning the domain.
+     * @tparam TOutputIterator a model of output iterator
+     * @tparam TExecutor a model of executor (see SerialExecutor).
+     */
+    template< typename TOutputIterator, typename TExecutor >
+    void computeComplement(TOutputIterator& ito,
+                           const TExecutor & anExecutor) const;
+
     /**
      * Builds the complement in the domain of the set [other_set] in
      * this.
@@ -348,6 +382,28 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /// 'true' type if Domain is a HyperRectDomain.
+    typedef typename boost::is_same< Domain,
+      HyperRectDomain<typename Domain::Space> >::type IsRectangular;
+
+    /**
+     * Outputs the points of the domain which are not in @a points
+     * (HyperRectDomain: parallel slab scan).
+     */
+    template< typename TOutputIterator, typename TExecutor >
+    void complementOf( const std::set<Point> & points, TOutputIterator& ito,
+                       const TExecutor & anExecutor,
+                       boost::true_type ) const;
+
+    /**
+     * Outputs the points of the domain which are not in @a points
+     * (any other domain: one search per domain point).
+     */
+    template< typename TOutputIterator, typename TExecutor >
+    void complementOf( const std::set<Point> & points, TOutputIterator& ito,
+                       const TExecutor & anExecutor,
+                       boost::false_type ) const;
+
 
   }; // end of class DigitalSetBySTLSet
 
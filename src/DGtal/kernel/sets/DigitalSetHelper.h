@@ -0,0 +1,133 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSetHelper.h
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Header file for module DigitalSetHelper.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSetHelper_RECURSES)
+#error Recursive header files inclusion detected in DigitalSetHelper.h
+#else // defined(DigitalSetHelper_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSetHelper_RECURSES
+
+#if !defined DigitalSetHelper_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSetHelper_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <algorithm>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Executors.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  namespace detail
+  {
+    /**
+     * Comparator of points following the scanning order of a
+     * HyperRectDomain, i.e. the last coordinate is the most
+     * significant one.
+     *
+     * Note that this differs from PointVector::operator<, for which
+     * the first coordinate is the most significant one.
+     */
+    struct DomainOrder
+    {
+      /**
+       * @param a any point.
+       * @param b any point.
+       * @return 'true' if @a a is visited before @a b when scanning a
+       * HyperRectDomain.
+       */
+      template <typename TPoint>
+      bool operator()( const TPoint & a, const TPoint & b ) const
+      {
+        return std::lexicographical_compare( a.rbegin(), a.rend(),
+                                             b.rbegin(), b.rend() );
+      }
+    };
+  } // namespace detail
+
+  /**
+   * Outputs the points of @a aDomain that do not belong to the
+   * range [@a itb, @a ite), in the domain scanning order.
+   *
+   * The domain is cut into slabs along its last coordinate; each
+   * slab is scanned by a task of @a anExecutor, in lockstep with its
+   * part of the point range, and the results of the slabs are then
+   * concatenated in order. The overall cost is O(|D| + n log n).
+   *
+   * @param aDomain the domain.
+   * @param itb begin iterator on the points, which must be sorted
+   * with detail::DomainOrder. Points outside @a aDomain are ignored.
+   * @param ite end iterator on the points.
+   * @param ito an output iterator on points.
+   * @param anExecutor the executor running the slab tasks.
+   *
+   * @tparam TSpace type of digital space.
+   * @tparam TPointIterator a random access iterator on points.
+   * @tparam TOutputIterator a model of output iterator on points.
+   * @tparam TExecutor a model of executor (see SerialExecutor).
+   */
+  template <typename TSpace, typename TPointIterator,
+            typename TOutputIterator, typename TExecutor>
+  void complementInDomain( const HyperRectDomain<TSpace> & aDomain,
+                           TPointIterator itb, TPointIterator ite,
+                           TOutputIterator & ito,
+                           const TExecutor & anExecutor );
+
+  /**
+   * Outputs the points of @a aDomain that do not belong to the
+   * range [@a itb, @a ite), with the default executor.
+   *
+   * @see complementInDomain( aDomain, itb, ite, ito, anExecutor )
+   */
+  template <typename TSpace, typename TPointIterator,
+            typename TOutputIterator>
+  void complementInDomain( const HyperRectDomain<TSpace> & aDomain,
+                           TPointIterator itb, TPointIterator ite,
+                           TOutputIterator & ito );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/kernel/sets/DigitalSetHelper.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSetHelper_h
+
+#undef DigitalSetHelper_RECURSES
+#endif // else defined(DigitalSetHelper_RECURSES)
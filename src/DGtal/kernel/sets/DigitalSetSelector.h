@@ -45,9 +45,13 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <boost/mpl/if.hpp>
+#include <boost/type_traits/is_same.hpp>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
+#include "DGtal/kernel/sets/DigitalSetByHashSet.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -58,6 +62,7 @@ namespace DGtal
   enum DigitalSetVariability { LOW_VAR_DS = 0, HIGH_VAR_DS = 4 };
   enum DigitalSetIterability { LOW_ITER_DS = 0, HIGH_ITER_DS = 8 };
   enum DigitalSetBelongTestability { LOW_BEL_DS = 0, HIGH_BEL_DS = 16 };
+  enum DigitalSetDomainSize { NORMAL_DOMAIN_DS = 0, HUGE_DOMAIN_DS = 32 };
 
   /////////////////////////////////////////////////////////////////////////////
   // template class DigitalSetSelector
@@ -80,15 +85,40 @@ namespace DGtal
    SpecificSet set1( domain );
    *
    * @endcode
+   *
+   * Sets in huge domains (HUGE_DOMAIN_DS, e.g. 10^12 points) are
+   * DigitalSetByHashSet, whatever their other hints. Otherwise, big
+   * (BIG_DS or WHOLE_DS) sets with a high variability (HIGH_VAR_DS)
+   * in a HyperRectDomain are DigitalSetByBitVector. Small sets with a
+   * low variability and a low belonging testability
+   * (SMALL_DS+LOW_VAR_DS+LOW_BEL_DS, with a low or high iterability)
+   * are DigitalSetBySTLVector (see the specializations in
+   * DigitalSetSelector.ih). All the other sets are DigitalSetBySTLSet.
    */
   template <typename Domain, int Preferences >
   struct DigitalSetSelector
   {
     // ----------------------- Local types ------------------------------
+    /// Big set with a high variability
+    static const bool isDense = ( ( Preferences & 3 ) >= BIG_DS )
+      && ( ( Preferences & HIGH_VAR_DS ) != 0 );
+
+    /// Rectangular domain
+    static const bool isRectangular =
+      boost::is_same< Domain, HyperRectDomain<typename Domain::Space> >::value;
+
+    /// Sparse set in a huge domain
+    static const bool isHuge = ( Preferences & HUGE_DOMAIN_DS ) != 0;
+
     /**
      * Adequate digital set representation for the given preferences.
      */
-    typedef DigitalSetBySTLSet<Domain> Type;
+    typedef typename boost::mpl::if_c< isHuge,
+                                       DigitalSetByHashSet<Domain>,
+                                       typename boost::mpl::if_c< isDense && isRectangular,
+                                                                  DigitalSetByBitVector<Domain>,
+                                                                  DigitalSetBySTLSet<Domain> >::type
+                                       >::type Type;
 
 
   }; // end of class DigitalSetSelector
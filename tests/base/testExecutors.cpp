@@ -0,0 +1,120 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testExecutors.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing the executors of Executors.h.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Executors.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the executors.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Task counting the number of times each task index is run and
+ * checking the worker indices. Each task only writes its own cells.
+ */
+struct CountingTask
+{
+  std::vector<unsigned int> counts;
+  std::vector<unsigned int> badWorkers;
+  std::size_t nbWorkers;
+
+  CountingTask(const std::size_t n, const std::size_t aNbWorkers)
+    : counts( n, 0 ), badWorkers( n, 0 ), nbWorkers( aNbWorkers ) {}
+
+  void operator()(const std::size_t worker, const std::size_t i)
+  {
+    counts[ i ]++;
+    if ( worker >= nbWorkers )
+      badWorkers[ i ]++;
+  }
+};
+
+template <typename Executor>
+bool testExecutor(const Executor & executor)
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing executor ..." );
+  trace.info() << executor << std::endl;
+
+  nbok += ( executor.isValid() && executor.nbWorkers() > 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "valid executor" << std::endl;
+
+  const std::size_t sizes[] = { 0, 1, 7, 1000, 100000 };
+  for(unsigned int s = 0; s < 5; ++s)
+    {
+      CountingTask task( sizes[s], executor.nbWorkers() );
+      executor.run( sizes[s], task );
+
+      bool ok = true;
+      for(std::size_t i = 0; i < sizes[s]; ++i)
+        ok = ok && ( task.counts[i] == 1 ) && ( task.badWorkers[i] == 0 );
+
+      nbok += ok ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << sizes[s] << " tasks run exactly once" << std::endl;
+    }
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing executors" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testExecutor( SerialExecutor() )
+    && testExecutor( OpenMPExecutor() )
+    && testExecutor( DefaultExecutor() );
+#ifdef CPP11_THREAD
+  res = res && testExecutor( ThreadPoolExecutor() );
+#endif
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
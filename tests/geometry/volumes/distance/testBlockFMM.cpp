@@ -0,0 +1,222 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBlockFMM.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ * @date 2026/10/17
+ *
+ * @brief Functions for testing class BlockFMM.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <vector>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/DomainPredicate.h"
+#include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+
+#include "DGtal/geometry/volumes/distance/FMM.h"
+#include "DGtal/geometry/volumes/distance/BlockFMM.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BlockFMM.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Digital ball of radius @a myR centered at the origin
+ */
+template <typename TPoint>
+struct BallPredicate
+{
+  typedef TPoint Point;
+  BallPredicate( double aR ): myR( aR ) {}
+  bool operator()( const Point& aPoint ) const
+  {
+    double n = 0;
+    for (DGtal::Dimension k = 0; k < Point::dimension; ++k)
+      n += aPoint[k]*aPoint[k];
+    return ( n <= myR*myR );
+  }
+  double myR;
+};
+
+/**
+ * Computes the distance map from the accepted points of
+ * @a aInitialMap with FMM and with BlockFMM (blocks of size
+ * @a aBlockSize) and compares them.
+ */
+template <typename TImage, template <typename, typename> class TDistance,
+	  typename TExecutor>
+bool compareWithFMM(const TImage& aInitialMap,
+		    typename TImage::Point::Coordinate aBlockSize,
+		    double aValueThreshold, double aTolerance, double aMaxError)
+{
+  typedef TImage Image;
+  typedef typename Image::Domain Domain;
+  typedef typename Image::Point Point;
+  typedef DigitalSetFromMap<Image> Set;
+  typedef DomainPredicate<Domain> Predicate;
+  typedef TDistance<Image, Set> Distance;
+
+  const Domain& d = aInitialMap.domain();
+  Predicate dp( d );
+
+  //serial FMM
+  Image map1( aInitialMap );
+  Set set1( map1 );
+  Distance distance( map1, set1 );
+  FMM<Image, Set, Predicate, Distance>
+    fmm( map1, set1, dp, d.size()+1, aValueThreshold, distance );
+  fmm.compute();
+  trace.info() << fmm << std::endl;
+
+  //block FMM
+  Image map2( aInitialMap );
+  Set set2( map2 );
+  BlockFMM<Image, Set, Predicate, TDistance, TExecutor>
+    blockFMM( map2, set2, dp, Point::diagonal( aBlockSize ),
+	      aValueThreshold, aTolerance );
+  blockFMM.compute();
+  trace.info() << blockFMM << std::endl;
+
+  bool flagIsOk = ( blockFMM.isValid() && (set1.size() == set2.size()) );
+  double maxError = 0;
+  typename Set::ConstIterator it = set1.begin();
+  typename Set::ConstIterator itEnd = set1.end();
+  for ( ; ( (it != itEnd)&&(flagIsOk) ); ++it)
+    {
+      if (set2.find(*it) == set2.end())
+	flagIsOk = false;
+      else
+	maxError = std::max( maxError, std::abs( map1(*it) - map2(*it) ) );
+    }
+  trace.info() << "size: " << set1.size() << " / " << set2.size()
+	       << ", max error: " << maxError << std::endl;
+  return ( flagIsOk && (maxError <= aMaxError) );
+}
+
+/**
+ * Signed distance to a circle (initFromBelsRange)
+ * and distance to random points in 3d.
+ */
+template <typename TExecutor>
+bool testBlockFMM(int size)
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Block FMM vs FMM" );
+
+  {  //2d, signed distance from a circle
+    static const DGtal::Dimension dimension = 2;
+    typedef HyperRectDomain< SpaceND<dimension, int> > Domain;
+    typedef Domain::Point Point;
+    Domain d(Point::diagonal(-size), Point::diagonal(size));
+
+    typedef KhalimskySpaceND< dimension, int > KSpace;
+    KSpace K; K.init( d.lowerBound(), d.upperBound(), true );
+    std::set<KSpace::SCell> bels;
+    Surfaces<KSpace>::sMakeBoundary( bels, K, BallPredicate<Point>( size/2.0 ),
+				     d.lowerBound(), d.upperBound() );
+
+    typedef ImageContainerBySTLMap<Domain,double> Image;
+    typedef DigitalSetFromMap<Image> Set;
+    Image map( d );
+    Set set( map );
+    FMM<Image, Set, DomainPredicate<Domain> >
+      ::initFromBelsRange( K, bels.begin(), bels.end(), map, set, 0.5 );
+
+    nbok += compareWithFMM<Image, L2FirstOrderLocalDistance, TExecutor>
+      ( map, 8, std::numeric_limits<double>::max(), 0, 1e-9 ) ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << ++nb << ") L2, blocks of size 8" << std::endl;
+    nbok += compareWithFMM<Image, L2FirstOrderLocalDistance, TExecutor>
+      ( map, 5, size/4, 0, 1e-9 ) ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << ++nb << ") L2, blocks of size 5, narrow band" << std::endl;
+    nbok += compareWithFMM<Image, L2FirstOrderLocalDistance, TExecutor>
+      ( map, 3*size, std::numeric_limits<double>::max(), 0, 0 ) ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << ++nb << ") L2, one block == FMM" << std::endl;
+    nbok += compareWithFMM<Image, LInfLocalDistance, TExecutor>
+      ( map, 7, std::numeric_limits<double>::max(), 0, 0 ) ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << ++nb << ") LInf, blocks of size 7" << std::endl;
+    nbok += compareWithFMM<Image, L2FirstOrderLocalDistance, TExecutor>
+      ( map, 4, std::numeric_limits<double>::max(), 0.01, 0.01*20 ) ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << ++nb << ") L2, tolerance 0.01" << std::endl;
+  }
+
+  {  //3d, distance from a few points
+    static const DGtal::Dimension dimension = 3;
+    typedef HyperRectDomain< SpaceND<dimension, int> > Domain;
+    typedef Domain::Point Point;
+    Domain d(Point(0,0,0), Point(size-1,size/2,size/3));
+
+    typedef ImageContainerBySTLMap<Domain,double> Image;
+    Image map( d );
+    for (int i = 0; i < 3; ++i)
+      map.setValue( Point( rand()%size, rand()%(size/2+1), rand()%(size/3+1) ), 0.0 );
+
+    nbok += compareWithFMM<Image, L1LocalDistance, TExecutor>
+      ( map, 6, std::numeric_limits<double>::max(), 0, 0 ) ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << ++nb << ") L1, blocks of size 6" << std::endl;
+    nbok += compareWithFMM<Image, L2FirstOrderLocalDistance, TExecutor>
+      ( map, 5, std::numeric_limits<double>::max(), 0, 1e-9 ) ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << ++nb << ") L2, blocks of size 5" << std::endl;
+    nbok += compareWithFMM<Image, L2FirstOrderLocalDistance, TExecutor>
+      ( map, 1, 6, 0, 1e-9 ) ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << ++nb << ") L2, blocks of size 1, narrow band" << std::endl;
+  }
+
+  trace.endBlock();
+  return (nb == nbok);
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class BlockFMM" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testBlockFMM<SerialExecutor>( 20 )
+    && testBlockFMM<DefaultExecutor>( 31 );
+#ifdef CPP11_THREAD
+  res = res && testBlockFMM<ThreadPoolExecutor>( 31 );
+#endif
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
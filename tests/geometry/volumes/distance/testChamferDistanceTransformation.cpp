@@ -0,0 +1,213 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testChamferDistanceTransformation.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ChamferDistanceTransformation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <queue>
+#include <functional>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/ChamferDistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ChamferDistanceTransformation.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Reference chamfer distances: Dijkstra's algorithm on the graph
+ * of the mask vectors, from the points of @a aSet.
+ */
+template <typename Image, typename Set, typename Mask>
+void dijkstra( const Set & aSet, const Mask & aMask, Image & anImage )
+{
+  typedef typename Image::Domain Domain;
+  typedef typename Image::Point Point;
+  typedef typename Image::Value Value;
+  typedef std::pair<Value, Point> Node;
+  const Domain & domain = anImage.domain();
+
+  std::priority_queue<Node, std::vector<Node>, std::greater<Node> > queue;
+  for ( typename Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    {
+      const bool site = aSet.find( *it ) != aSet.end();
+      anImage.setValue( *it, site ? 0 : std::numeric_limits<Value>::max() );
+      if ( site )
+        queue.push( Node( 0, *it ) );
+    }
+  while ( ! queue.empty() )
+    {
+      const Node n = queue.top();
+      queue.pop();
+      if ( n.first > anImage( n.second ) )
+        continue;
+      for ( typename Mask::ConstIterator it = aMask.begin(), itEnd = aMask.end();
+            it != itEnd; ++it )
+        {
+          const Point q = n.second + it->first;
+          if ( domain.isInside( q ) && ( n.first + it->second < anImage( q ) ) )
+            {
+              anImage.setValue( q, n.first + it->second );
+              queue.push( Node( n.first + it->second, q ) );
+            }
+        }
+    }
+}
+
+/**
+ * Compares the chamfer DT of random sites with Dijkstra's
+ * algorithm and checks the relative error with respect to the
+ * Euclidean DT.
+ */
+template <typename Space, typename TExecutor>
+bool checkMask( const typename Space::Point & aLow,
+                const typename Space::Point & anUp,
+                const ChamferMask<Space> & aMask,
+                const unsigned int nbSites,
+                const double aMaxError )
+{
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename Space::Point Point;
+  typedef DigitalSetBySTLSet<Domain> Set;
+  typedef NotPointPredicate<Set> Predicate;
+  typedef ImageContainerBySTLVector<Domain, DGtal::uint32_t> Image;
+  typedef ExactPredicateLpSeparableMetric<Space, 2> L2Metric;
+
+  Domain domain( aLow, anUp );
+  Set set( domain );
+  for ( unsigned int i = 0; i < nbSites; ++i )
+    {
+      Point p;
+      for ( Dimension k = 0; k < Space::dimension; ++k )
+        p[k] = aLow[k] + rand() % ( anUp[k] - aLow[k] + 1 );
+      set.insert( p );
+    }
+  Predicate predicate( set );
+
+  Image image( domain );
+  ChamferDistanceTransformation<Predicate, Image, TExecutor> dt( predicate, aMask, image );
+  trace.info() << dt << std::endl;
+
+  Image reference( domain );
+  dijkstra( set, aMask, reference );
+
+  L2Metric l2;
+  DistanceTransformation<Space, Predicate, L2Metric> edt( &domain, &predicate, &l2 );
+
+  bool ok = dt.isValid();
+  double maxError = 0;
+  for ( typename Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    {
+      if ( dt( *it ) != reference( *it ) )
+        {
+          trace.error() << "Error at " << *it << ": " << dt( *it )
+                        << " != " << reference( *it ) << std::endl;
+          ok = false;
+          break;
+        }
+      const double e = edt( *it );
+      if ( e > 0 )
+        maxError = std::max( maxError, std::abs( dt.distance( *it ) - e ) / e );
+    }
+  trace.info() << "max relative error = " << maxError << std::endl;
+  return ok && ( maxError <= aMaxError );
+}
+
+template <typename TExecutor>
+bool testChamferDistanceTransformation()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing ChamferDistanceTransformation" );
+
+  nbok += checkMask<Z2i::Space, TExecutor>
+    ( Z2i::Point( -3, 2 ), Z2i::Point( 60, 45 ),
+      ChamferMask<Z2i::Space>::mask34(), 10, 0.058 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << ++nb << ") 2D, <3,4>" << std::endl;
+  nbok += checkMask<Z2i::Space, TExecutor>
+    ( Z2i::Point( 0, 0 ), Z2i::Point( 50, 70 ),
+      ChamferMask<Z2i::Space>::mask5711(), 10, 0.021 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << ++nb << ") 2D, <5,7,11>" << std::endl;
+  nbok += checkMask<Z3i::Space, TExecutor>
+    ( Z3i::Point( -4, 0, 3 ), Z3i::Point( 20, 17, 25 ),
+      ChamferMask<Z3i::Space>::mask345(), 5, 0.106 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << ++nb << ") 3D, <3,4,5>" << std::endl;
+  nbok += checkMask<Z3i::Space, TExecutor>
+    ( Z3i::Point( 0, 0, 0 ), Z3i::Point( 15, 22, 18 ),
+      ChamferMask<Z3i::Space>::mask71012(), 5, 0.125 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << ++nb << ") 3D, <7,10,12>" << std::endl;
+
+  //A 5x5x5 mask (radius 2) spans two rows in the wavefronts.
+  ChamferMask<Z3i::Space> mask( 5 );
+  mask.addVector( Z3i::Vector( 1, 0, 0 ), 5 );
+  mask.addVector( Z3i::Vector( 1, 1, 0 ), 7 );
+  mask.addVector( Z3i::Vector( 1, 1, 1 ), 9 );
+  mask.addVector( Z3i::Vector( 2, 1, 0 ), 11 );
+  mask.addVector( Z3i::Vector( 2, 1, 1 ), 12 );
+  mask.addVector( Z3i::Vector( 2, 2, 1 ), 15 );
+  trace.info() << mask << std::endl;
+  nbok += checkMask<Z3i::Space, TExecutor>
+    ( Z3i::Point( 0, 0, 0 ), Z3i::Point( 17, 19, 14 ), mask, 5, 0.04 ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << ++nb << ") 3D, 5x5x5 mask" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ChamferDistanceTransformation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testChamferDistanceTransformation<SerialExecutor>()
+    && testChamferDistanceTransformation<DefaultExecutor>();
+#ifdef CPP11_THREAD
+  res = res && testChamferDistanceTransformation<ThreadPoolExecutor>();
+#endif
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -619,6 +619,76 @@ bool testCompareExactInexact(unsigned int size, unsigned int nb)
   return true;
 }
 
+template <typename Space, int norm>
+bool testUpdate(unsigned int size)
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock("Checking incremental updates");
+  typedef ExactPredicateLpSeparableMetric<Space, norm> Metric;
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename Space::Point Point;
+  typedef DigitalSetBySTLSet<Domain> Set;
+  typedef DistanceTransformation<Space, Set, Metric> DT;
+
+  Point low=Point::diagonal(0),
+    up=Point::diagonal(size);
+  up[0] += 3;
+  Domain domain(low,up);
+  Metric metric;
+
+  //Foreground with a few background points
+  Set set(domain);
+  for(typename Domain::ConstIterator it = domain.begin(), itend = domain.end();
+      it != itend; ++it)
+    if ( rand() % 40 != 0 )
+      set.insertNew( *it );
+  trace.info()<< "Space dimension "<<Space::dimension
+              << ", "<< set.size() << " foreground points."<<std::endl;
+
+  DT dt(&domain, &set, &metric);
+
+  for(unsigned int round = 0; round < 4; ++round)
+    {
+      //Local edit around a random center
+      Point center;
+      for(unsigned int dim=0;  dim<Space::dimension;++dim)
+        center[dim]  = rand() % (up[dim] + 1);
+      std::vector<Point> added, removed;
+      for(unsigned int i = 0; i < 20; ++i)
+        {
+          Point p = center;
+          for(unsigned int dim=0;  dim<Space::dimension;++dim)
+            p[dim] = std::max( low[dim], std::min( up[dim], p[dim] + rand() % 5 - 2 ) );
+          if ( set( p ) )
+            {
+              set.erase( p );
+              removed.push_back( p );
+            }
+          else
+            {
+              set.insert( p );
+              added.push_back( p );
+            }
+        }
+      dt.update( added, removed );
+
+      DT dtRef(&domain, &set, &metric);
+      bool same = true;
+      for(typename Domain::ConstIterator it = domain.begin(), itend = domain.end();
+          it != itend; ++it)
+        same = same && ( dt.getVoronoiVector( *it ) == dtRef.getVoronoiVector( *it ) )
+          && ( dt( *it ) == dtRef( *it ) );
+      nbok += same ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "update "<< round << " == complete computation" << std::endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -640,6 +710,10 @@ int main ( int argc, char** argv ){
     && testCompareExactInexact<Z3i::Space, 2>(50, 50)
     && testCompareExactInexact<Z2i::Space, 4>(50, 50)
     && testCompareExactInexact<Z3i::Space, 4>(50, 50)
+    && testUpdate<Z2i::Space, 2>(40)
+    && testUpdate<Z3i::Space, 2>(20)
+    && testUpdate<Z3i::Space, 3>(20)
+    && testUpdate<SpaceND<4>, 2>(8)
     ;
   //&& ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -0,0 +1,141 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFMM-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ * @date 2026/10/17
+ *
+ * @brief Benchmark of the containers of candidate points of FMM.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/kernel/domains/DomainPredicate.h"
+#include "DGtal/kernel/sets/DigitalSetFromMap.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/topology/KhalimskySpaceND.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/geometry/volumes/distance/FMM.h"
+#include <boost/lexical_cast.hpp>
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking the containers of candidate points of FMM.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef HyperRectDomain< SpaceND<3, int> > Domain;
+typedef Domain::Point Point;
+typedef ImageContainerBySTLMap<Domain,double> Image;
+typedef DigitalSetFromMap<Image> Set;
+typedef DomainPredicate<Domain> Predicate;
+typedef KhalimskySpaceND<3, int> KSpace;
+
+/**
+ * Digital ball of radius @a myR centered at the origin.
+ */
+struct BallPredicate
+{
+  typedef Point::Coordinate Coordinate;
+  BallPredicate( double aR ): myR( aR ) {}
+  bool operator()( const Point& aPoint ) const
+  {
+    return ( aPoint[0]*aPoint[0] + aPoint[1]*aPoint[1] + aPoint[2]*aPoint[2]
+             <= myR*myR );
+  }
+  double myR;
+};
+
+/**
+ * Signed distance from the boundary of a ball of radius 
+ * @a size / 2, in the domain [-size,size]^3, up to @a width.
+ */
+template <typename TCandidatePointSet>
+Image runFMM( const int size, const double width, const std::string& name )
+{
+  typedef FMM<Image, Set, Predicate, 
+    L2FirstOrderLocalDistance<Image, Set>, TCandidatePointSet> FMM;
+
+  Domain d( Point::diagonal(-size), Point::diagonal(size) );
+  Predicate dp( d );
+
+  //bels of the ball
+  KSpace K;
+  K.init( d.lowerBound(), d.upperBound(), true );
+  std::set<KSpace::SCell> bels;
+  Surfaces<KSpace>::sMakeBoundary( bels, K, BallPredicate( size / 2.0 ),
+                                   d.lowerBound(), d.upperBound() );
+
+  Image map( d );
+  Set set( map );
+  FMM::initFromBelsRange( K, bels.begin(), bels.end(), map, set, 0.5 );
+
+  trace.beginBlock( name );
+  FMM fmm( map, set, dp, d.size(), width );
+  fmm.compute();
+  trace.info() << fmm << std::endl;
+  trace.endBlock();
+  return map;
+}
+
+bool runATest( const int size, const double width )
+{
+  std::string txt = "Domain " + boost::lexical_cast<string>( 2*size+1 ) + "^3, width "
+    + boost::lexical_cast<string>( width );
+  trace.beginBlock( txt );
+
+  Image map1 = runFMM< CandidatePointSetBySTLSet<Domain, double> >
+    ( size, width, "FMM (STL set)" );
+  Image map2 = runFMM< CandidatePointSetByRadixHeap<Domain, double> >
+    ( size, width, "FMM (radix heap)" );
+
+  bool ok = ( map1.size() == map2.size() );
+  for ( Image::const_iterator it = map1.begin(), itEnd = map1.end();
+        ( ok && (it != itEnd) ); ++it )
+    ok = ( map2( it->first ) == it->second );
+  trace.info() << "Same values: " << ok << std::endl;
+  trace.endBlock();
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing FMM-benchmark" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = runATest( 48, 5.0 )
+    && runATest( 32, 100.0 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -653,6 +653,184 @@ bool testComparison(int size, int area, double dist)
 
 
 
+/**
+ * Random insertions into the two containers of candidate points. 
+ * The points must be accepted in the same order. 
+ */
+bool compareCandidatePointSets(int size, int nbInsertions)
+{
+  typedef HyperRectDomain< SpaceND<2, int> > Domain; 
+  typedef Domain::Point Point; 
+  typedef CandidatePointSetBySTLSet<Domain, double> CandidatePointSet1; 
+  typedef CandidatePointSetByRadixHeap<Domain, double> CandidatePointSet2; 
+  typedef CandidatePointSet1::PointValue PointValue; 
+  Domain d(Point::diagonal(-size), Point::diagonal(size)); 
+
+  CandidatePointSet1 c1( d ); 
+  CandidatePointSet2 c2( d ); 
+  std::set<Point> accepted1, accepted2; 
+  double last = 0.0; 
+  bool flagIsOk = true; 
+  for (int i = 0; ( (i < nbInsertions)&&(flagIsOk) ); ++i)
+    {
+      //values greater than the last accepted one, with ties and signs
+      Point p( (rand()%(2*size+1)) - size, (rand()%(2*size+1)) - size ); 
+      double v = last + 0.5*(rand()%4); 
+      if (rand()%2 == 0) v = -v; 
+      if ( !c2.isAccepted( p, accepted2 ) )
+	{
+	  c1.insert( PointValue(p, v) ); 
+	  c2.insert( PointValue(p, v) ); 
+	}
+      if (rand()%3 == 0)
+	{ //the point of smallest value is accepted 
+	  //(the points already accepted are skipped as in FMM)
+	  PointValue pv1( Point::diagonal(0), -1.0 ), pv2( pv1 ); 
+	  while ( (!c1.empty()) && (!accepted1.insert( c1.top().first ).second) )
+	    c1.pop(); 
+	  if (!c1.empty())
+	    { pv1 = c1.top(); c1.pop(); c1.accept( pv1.first ); }
+	  while ( (!c2.empty()) && (!accepted2.insert( c2.top().first ).second) )
+	    c2.pop(); 
+	  if (!c2.empty())
+	    { pv2 = c2.top(); c2.pop(); c2.accept( pv2.first ); }
+	  flagIsOk = ( (pv1 == pv2) && (c1.empty() == c2.empty()) ); 
+	  if (pv1.second != -1.0)
+	    last = std::abs( pv1.second ); 
+	}
+    }
+  return flagIsOk; 
+}
+
+/**
+ * Comparison of the two containers of candidate points: 
+ * the STL set (default) and the radix heap. 
+ * The points are accepted in the same order, 
+ * so the results are the same, even when
+ * the computation is stopped by the area threshold. 
+ */
+template <typename TImage, template <typename, typename> class TDistance>
+bool compareCandidatePointSets(const TImage& aInitialMap, 
+			       typename TImage::Domain::Size area, 
+			       double dist)
+{
+  typedef TImage Image; 
+  typedef typename Image::Domain Domain; 
+  typedef DigitalSetFromMap<Image> Set; 
+  typedef TDistance<Image, Set> Distance; 
+  typedef DomainPredicate<Domain> Predicate; 
+  typedef CandidatePointSetByRadixHeap<Domain, typename Distance::Value> RadixHeap; 
+  typedef FMM<Image, Set, Predicate, Distance > FMM1; 
+  typedef FMM<Image, Set, Predicate, Distance, RadixHeap > FMM2; 
+
+  const Domain& d = aInitialMap.domain(); 
+  Predicate dp(d); 
+
+  Image map1( aInitialMap ); 
+  Set set1( map1 ); 
+  Distance distance1( map1, set1 ); 
+  FMM1 fmm1( map1, set1, dp, area, dist, distance1 ); 
+  fmm1.compute(); 
+  trace.info() << fmm1 << std::endl; 
+
+  Image map2( aInitialMap ); 
+  Set set2( map2 ); 
+  Distance distance2( map2, set2 ); 
+  FMM2 fmm2( map2, set2, dp, area, dist, distance2 ); 
+  fmm2.compute(); 
+  trace.info() << fmm2 << std::endl; 
+
+  bool flagIsOk = ( fmm1.isValid() && fmm2.isValid() 
+		    && (set1.size() == set2.size()) ); 
+  typename Set::ConstIterator it = set1.begin(); 
+  typename Set::ConstIterator itEnd = set1.end(); 
+  for ( ; ( (it != itEnd)&&(flagIsOk) ); ++it)
+    {
+      if (set2.find(*it) == set2.end())
+	flagIsOk = false; 
+      else if (map1(*it) != map2(*it))
+	flagIsOk = false; 
+    }
+  return flagIsOk; 
+}
+
+bool testCandidatePointSets(int size)
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Comparison of the candidate point sets " );
+
+  nbok += compareCandidatePointSets( size, 100*size ) ? 1 : 0; 
+  trace.info() << nbok << "/" << ++nb << std::endl; 
+
+  {  //2d, signed distance from a circle
+    static const DGtal::Dimension dimension = 2; 
+    typedef HyperRectDomain< SpaceND<dimension, int> > Domain; 
+    typedef Domain::Point Point; 
+    Domain d(Point::diagonal(-size), Point::diagonal(size)); 
+
+    typedef BallPredicate<Point> Predicate; 
+    Predicate predicate( 0, 0, size/2 ); 
+    typedef KhalimskySpaceND< dimension, int > KSpace; 
+    KSpace K; K.init( Point::diagonal(-size), Point::diagonal(size), true); 
+    SurfelAdjacency<KSpace::dimension> SAdj( true );
+    KSpace::SCell bel = Surfaces<KSpace>::findABel( K, predicate, 10000 );
+    std::vector<KSpace::SCell> vSCells;
+    Surfaces<KSpace>::track2DBoundary( vSCells, K, SAdj, predicate, bel );
+
+    typedef ImageContainerBySTLMap<Domain,double> Image; 
+    typedef DigitalSetFromMap<Image> Set; 
+    Image map( d ); 
+    Set set( map ); 
+    FMM<Image, Set, Predicate>::initFromBelsRange( K, 
+						   vSCells.begin(), vSCells.end(), 
+						   map, set, 0.5 ); 
+
+    nbok += compareCandidatePointSets<Image, L2FirstOrderLocalDistance>
+      ( map, d.size()+1, size ) ? 1 : 0; 
+    trace.info() << nbok << "/" << ++nb << std::endl; 
+    nbok += compareCandidatePointSets<Image, L2FirstOrderLocalDistance>
+      ( map, d.size()/3, size ) ? 1 : 0; 
+    trace.info() << nbok << "/" << ++nb << std::endl; 
+    nbok += compareCandidatePointSets<Image, LInfLocalDistance>
+      ( map, d.size()+1, size/4 ) ? 1 : 0; 
+    trace.info() << nbok << "/" << ++nb << std::endl; 
+  }
+
+  {  //3d, distance from a few points (many ties)
+    static const DGtal::Dimension dimension = 3; 
+    typedef HyperRectDomain< SpaceND<dimension, int> > Domain; 
+    typedef Domain::Point Point; 
+    Domain d(Point::diagonal(-size/2), Point::diagonal(size/2)); 
+
+    typedef ImageContainerBySTLMap<Domain,double> Image; 
+    Image map( d ); 
+    for (int i = 0; i < 5; ++i)
+      {
+	Point p; 
+	for (DGtal::Dimension k = 0; k < dimension; ++k)
+	  p[k] = (rand()%(2*(size/2)+1)) - size/2; 
+	map.setValue( p, 0.0 ); 
+      }
+
+    nbok += compareCandidatePointSets<Image, L1LocalDistance>
+      ( map, d.size()+1, 3*size ) ? 1 : 0; 
+    trace.info() << nbok << "/" << ++nb << std::endl; 
+    nbok += compareCandidatePointSets<Image, L1LocalDistance>
+      ( map, d.size()/2, 3*size ) ? 1 : 0; 
+    trace.info() << nbok << "/" << ++nb << std::endl; 
+    nbok += compareCandidatePointSets<Image, L2FirstOrderLocalDistance>
+      ( map, d.size()+1, size/3 ) ? 1 : 0; 
+    trace.info() << nbok << "/" << ++nb << std::endl; 
+  }
+
+  trace.endBlock();
+
+  return (nb == nbok); 
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -693,6 +871,12 @@ int main ( int argc, char** argv )
     && testComparison<4,1>( size, area, 4*size+1 )
     ;
 
+  //candidate point sets
+  size = 20; 
+  res = res
+    && testCandidatePointSets( size )
+    ;
+
   //&& ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 
@@ -462,6 +463,105 @@ bool testSpecialCasesL2()
   return nbok == nb;
 }
 
+/**
+ * Compares the cells given by the row kernels of the l_2 metric
+ * with the scan of the sites with hiddenBy and closest, on random
+ * lines of a 3D space.
+ *
+ * @param aShift shift of the lines: the abscissas are shifted
+ * along the line, and the lines away from the sites (large partial
+ * distances).
+ */
+bool testRowKernelsL2( const DGtal::int32_t aShift )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing row kernels L2..." );
+  trace.info() << "shift " << aShift << std::endl;
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> Metric;
+  typedef Metric::Abscissa Abscissa;
+  typedef Metric::Promoted Promoted;
+  Metric metric;
+
+  bool ok = true;
+  for (unsigned int trial = 0; (trial < 500) && ok; trial++)
+    {
+      const Z3i::Space::Dimension dim = rand() % 3;
+      const Abscissa lower = aShift + rand() % 5 - 2;
+      const Abscissa upper = lower + rand() % 30;
+      Z3i::Point starting( aShift + rand() % 5, aShift + rand() % 5, 
+                           aShift + rand() % 5 );
+      starting[dim] = lower;
+      Z3i::Point endpoint = starting;
+      endpoint[dim] = upper;
+
+      //Random sites, one per abscissa at most
+      std::vector<Z3i::Point> sites;
+      for (Abscissa x = lower; x <= upper; x++)
+        if ( rand() % 3 == 0 )
+          {
+            Z3i::Point site( rand() % 9 - 2, rand() % 9 - 2, rand() % 9 - 2 );
+            site[dim] = x;
+            sites.push_back( site );
+          }
+      if ( sites.empty() )
+        continue;
+
+      //Reference: stack of sites and scan of the line
+      std::vector<Z3i::Point> stack;
+      for (unsigned int i = 0; i < sites.size(); i++)
+        {
+          while ( (stack.size() >= 2) && 
+                  metric.hiddenBy( stack[stack.size()-2], stack.back(), sites[i],
+                                   starting, endpoint, dim ) )
+            stack.pop_back();
+          stack.push_back( sites[i] );
+        }
+      std::vector<Z3i::Point> expected;
+      Z3i::Point point = starting;
+      unsigned int k = 0;
+      for (Abscissa t = lower; t <= upper; t++, point[dim]++)
+        {
+          while ( (k + 1 < stack.size()) && 
+                  (metric.closest( point, stack[k], stack[k+1] ) != ClosestFIRST) )
+            k++;
+          expected.push_back( stack[k] );
+        }
+
+      //Row kernels
+      std::vector<Abscissa> x;
+      std::vector<Promoted> h;
+      std::vector<std::size_t> indices;
+      for (unsigned int i = 0; i < sites.size(); i++)
+        {
+          x.push_back( sites[i][dim] );
+          h.push_back( metric.exactDistanceRepresentation( sites[i], starting ) -
+                       ( sites[i][dim] - lower ) * ( sites[i][dim] - lower ) );
+          indices.push_back( i );
+        }
+      const std::size_t m = metric.lowerEnvelope( &x[0], &h[0], &indices[0], x.size() );
+      std::vector<Abscissa> ends( m );
+      metric.cellEnds( &x[0], &h[0], m, lower, upper, &ends[0] );
+
+      ok = ( m == stack.size() ) && ( ends.back() == upper + 1 );
+      Abscissa t = lower;
+      for (std::size_t j = 0; ok && (j < m); j++)
+        {
+          ok = ( sites[ indices[j] ] == stack[j] );
+          for ( ; ok && (t < ends[j]); t++ )
+            ok = ( sites[ indices[j] ] == expected[ t - lower ] );
+        }
+    }
+
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "row kernels == hiddenBy/closest scan" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -478,6 +578,9 @@ int main( int argc, char** argv )
     && testPowerMetrics()
     && testBinarySearch()
     && testSpecialCasesL2()
+    && testRowKernelsL2( 0 )
+    && testRowKernelsL2( 1 << 23 )
+    && testRowKernelsL2( 1 << 25 )
     && testSpecialCasesLp();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
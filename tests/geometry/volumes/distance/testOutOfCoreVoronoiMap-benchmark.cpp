@@ -0,0 +1,117 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testOutOfCoreVoronoiMap-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of OutOfCoreVoronoiMap against the in-memory VoronoiMap.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/ImageCachePolicies.h"
+#include "DGtal/images/TiledImageFromImage.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/OutOfCoreVoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include <boost/lexical_cast.hpp>
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking class OutOfCoreVoronoiMap.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2;
+typedef ImageContainerBySTLVector<Z3i::Domain, Z3i::Vector> Image;
+typedef ImageFactoryFromImage<Image> Factory;
+typedef Factory::OutputImage Tile;
+typedef ImageCacheReadPolicyFIFO<Tile, Factory> ReadPolicy;
+typedef ImageCacheWritePolicyWB<Tile, Factory> WritePolicy;
+typedef TiledImageFromImage<Image, Factory, ReadPolicy, WritePolicy> TiledImage;
+
+bool runATest( const Z3i::Integer size, const Z3i::Integer nbTiles,
+               const std::size_t aMemoryBudget )
+{
+  Z3i::Domain domain( Z3i::Point::diagonal(1), Z3i::Point::diagonal(size) );
+  Z3i::DigitalSet set( domain );
+  set.assignFromComplement( Z3i::DigitalSet( domain ) );
+  for(unsigned int i = 0; i < 1000; ++i)
+    set.erase( Z3i::Point( 1 + rand() % size, 1 + rand() % size, 1 + rand() % size ) );
+  L2 l2;
+
+  std::string txt = "Domain " + boost::lexical_cast<string>( size ) + "^3, "
+    + boost::lexical_cast<string>( nbTiles ) + "^3 tiles, budget "
+    + boost::lexical_cast<string>( aMemoryBudget / 1024 ) + "kB";
+  trace.beginBlock( txt );
+
+  trace.beginBlock( "In-memory VoronoiMap" );
+  VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2> voronoi( &domain, &set, &l2 );
+  trace.endBlock();
+
+  Image image( domain );
+  Factory factory( image );
+  ReadPolicy readPolicy( factory, nbTiles * nbTiles );
+  WritePolicy writePolicy( factory );
+  TiledImage tiled( image, factory, readPolicy, writePolicy, nbTiles );
+
+  trace.beginBlock( "OutOfCoreVoronoiMap" );
+  OutOfCoreVoronoiMap<Z3i::Space, Z3i::DigitalSet, L2, TiledImage>
+    outOfCore( domain, set, l2, tiled, aMemoryBudget );
+  trace.info() << outOfCore << std::endl;
+  trace.endBlock();
+
+  bool ok = true;
+  for(Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+      it != itend; ++it)
+    ok = ok && ( image( *it ) == voronoi( *it ) );
+  trace.info() << "Same map: " << ok << std::endl;
+  trace.endBlock();
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class OutOfCoreVoronoiMap-benchmark" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = runATest( 128, 4, 1024*1024 )
+    && runATest( 128, 4, 16*1024*1024 )
+    && runATest( 128, 8, 1024*1024 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
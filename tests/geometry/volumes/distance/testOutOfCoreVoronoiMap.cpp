@@ -0,0 +1,165 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testOutOfCoreVoronoiMap.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class OutOfCoreVoronoiMap.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageFactoryFromImage.h"
+#include "DGtal/images/ImageCachePolicies.h"
+#include "DGtal/images/TiledImageFromImage.h"
+#include "DGtal/geometry/volumes/distance/VoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/OutOfCoreVoronoiMap.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class OutOfCoreVoronoiMap.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Computes the Voronoi map of a random set in a tiled image (with
+ * the read policy TReadPolicy and a write-back policy) and compares
+ * it with VoronoiMap.
+ */
+template <typename Space, DGtal::uint32_t p, template <typename, typename> class TReadPolicy>
+bool testCompareWithVoronoiMap(const typename Space::Point &low,
+                               const typename Space::Point &up,
+                               const typename Space::Integer nbTiles,
+                               const std::size_t aMemoryBudget)
+{
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename Space::Vector Vector;
+  typedef DigitalSetBySTLSet<Domain> Set;
+  typedef ExactPredicateLpSeparableMetric<Space, p> Metric;
+  typedef ImageContainerBySTLVector<Domain, Vector> Image;
+  typedef ImageFactoryFromImage<Image> Factory;
+  typedef typename Factory::OutputImage Tile;
+  typedef TReadPolicy<Tile, Factory> ReadPolicy;
+  typedef ImageCacheWritePolicyWB<Tile, Factory> WritePolicy;
+  typedef TiledImageFromImage<Image, Factory, ReadPolicy, WritePolicy> TiledImage;
+
+  Domain domain(low, up);
+  Set set(domain);
+  for(typename Domain::ConstIterator it = domain.begin(), itend = domain.end();
+      it != itend; ++it)
+    if ( rand() % 30 != 0 )
+      set.insertNew( *it );
+
+  Metric metric;
+  VoronoiMap<Space, Set, Metric> voronoi(&domain, &set, &metric);
+
+  Image image(domain);
+  Factory factory(image);
+  ReadPolicy readPolicy(factory);
+  WritePolicy writePolicy(factory);
+  TiledImage tiled(image, factory, readPolicy, writePolicy, nbTiles);
+
+  OutOfCoreVoronoiMap<Space, Set, Metric, TiledImage>
+    outOfCore(domain, set, metric, tiled, aMemoryBudget);
+  trace.info() << outOfCore << std::endl;
+
+  //The underlying image is up to date after the computation
+  bool ok = outOfCore.isValid();
+  for(typename Domain::ConstIterator it = domain.begin(), itend = domain.end();
+      it != itend; ++it)
+    ok = ok && ( image( *it ) == voronoi( *it ) ) && ( outOfCore( *it ) == voronoi( *it ) );
+  return ok;
+}
+
+bool testOutOfCoreVoronoiMap()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing out-of-core Voronoi maps ..." );
+
+  Z2i::Point low2(1,1), up2(32,40);
+  nbok += testCompareWithVoronoiMap<Z2i::Space, 2, ImageCacheReadPolicyFIFO>
+    (low2, up2, 4, 1024*1024) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "2D l_2, one slab == VoronoiMap" << std::endl;
+
+  nbok += testCompareWithVoronoiMap<Z2i::Space, 2, ImageCacheReadPolicyFIFO>
+    (low2, up2, 4, 10 * 40 * sizeof(Z2i::Vector)) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "2D l_2, one tile per slab == VoronoiMap" << std::endl;
+
+  nbok += testCompareWithVoronoiMap<Z2i::Space, 2, ImageCacheReadPolicyLAST>
+    (low2, up2, 4, 0) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "2D l_2, row by row, LAST policy == VoronoiMap" << std::endl;
+
+  Z3i::Point low3(-3,-2,0), up3(20,17,22);
+  nbok += testCompareWithVoronoiMap<Z3i::Space, 2, ImageCacheReadPolicyFIFO>
+    (low3, up3, 3, 16 * 24 * sizeof(Z3i::Vector)) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "3D l_2, slabs smaller than a tile == VoronoiMap" << std::endl;
+
+  nbok += testCompareWithVoronoiMap<Z3i::Space, 2, ImageCacheReadPolicyLAST>
+    (low3, up3, 5, 300 * 24 * sizeof(Z3i::Vector)) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "3D l_2, LAST policy == VoronoiMap" << std::endl;
+
+  nbok += testCompareWithVoronoiMap<Z3i::Space, 3, ImageCacheReadPolicyFIFO>
+    (low3, up3, 4, 4096) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "3D l_3 == VoronoiMap" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class OutOfCoreVoronoiMap" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testOutOfCoreVoronoiMap(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
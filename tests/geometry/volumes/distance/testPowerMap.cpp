@@ -133,6 +133,98 @@ bool testPowerMap()
   return nbok == nb;
 }
 
+/**
+ * Brute force validation of a power map: the site of each point must
+ * be a weighted point and no weighted point may have a smaller power
+ * distance.
+ */
+template <typename Image, typename Power, typename Metric>
+bool checkPowerMapBruteForce(const Image &aWeights, const Power &power,
+                             const Metric &aMetric)
+{
+  typedef typename Power::Point Point;
+
+  for(typename Power::Domain::ConstIterator it = power.domain().begin(), itend = power.domain().end();
+      it != itend; ++it)
+    {
+      const Point psite = power(*it);
+      if ( ! aWeights.domain().isInside( psite ) )
+        {
+          trace.error() << "Power at " << *it << ": " << psite
+                        << " is not a site" << std::endl;
+          return false;
+        }
+      const typename Metric::Weight d =
+        aMetric.powerDistance( *it, psite, aWeights( psite ) );
+      for(typename Image::Domain::ConstIterator itsite = aWeights.domain().begin(),
+            itendSite = aWeights.domain().end(); itsite != itendSite; ++itsite)
+        if ( aMetric.powerDistance( *it, *itsite, aWeights( *itsite ) ) < d )
+          {
+            trace.error() << "Power at " << *it << ": " << psite
+                          << " (" << d << ")  from set: " << *itsite << std::endl;
+            return false;
+          }
+    }
+  return true;
+}
+
+/**
+ * The blocked separable passes must give a valid power map (checked
+ * by brute force) whatever the block size, and the same one as the
+ * row by row computation.
+ */
+bool testPowerMapBlockSize()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing PowerMap3D block sizes ..." );
+
+  Z3i::Domain domain(Z3i::Point(0,-2,1),Z3i::Point(29,17,12));
+  Z3i::DigitalSet set(domain);
+  for(Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+      it != itend; ++it)
+    if ( rand() % 40 == 0)
+      set.insertNew( *it );
+  DigitalSetDomain<Z3i::DigitalSet> setDomain(set); 
+  
+  typedef ImageContainerBySTLMap<DigitalSetDomain<Z3i::DigitalSet> , DGtal::int64_t> Image;
+  Image image(setDomain);
+  for(Z3i::DigitalSet::ConstIterator it = set.begin(), itend = set.end();
+      it != itend; ++it)
+    image.setValue( *it, rand() % 30 );
+  
+  Z3i::L2PowerMetric l2power;
+  typedef PowerMap<Image, Z3i::L2PowerMetric> Power;
+  Power powerRef(domain, image, l2power, 1);
+  nbok += checkPowerMapBruteForce( image, powerRef, l2power ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "row by row == brute force" << std::endl;
+
+  const Z3i::Space::Size sizes[] = { 3, 16, 64 };
+  for(unsigned int i = 0; i < 3; ++i)
+    {
+      Power power(domain, image, l2power, sizes[i]);
+      nbok += checkPowerMapBruteForce( image, power, l2power ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "block size " << sizes[i] << " == brute force" << std::endl;
+
+      bool same = true;
+      for(Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+          it != itend; ++it)
+        same = same && ( power(*it) == powerRef(*it) );
+      nbok += same ? 1 : 0; 
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "block size " << sizes[i] << " == row by row" << std::endl;
+    }
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -144,7 +236,8 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testPowerMap(); // && ... other tests
+  bool res = testPowerMap()
+    && testPowerMapBlockSize(); // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
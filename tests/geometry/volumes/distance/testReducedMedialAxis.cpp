@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <set>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/volumes/distance/PowerMap.h"
@@ -136,6 +137,69 @@ bool testReducedMedialAxis()
   return nbok == nb;
 }
 
+/**
+ * Compares the medial axis balls extracted by rows with the executor
+ * @a TExecutor with the sites found by a serial scan of a 3D power
+ * map, and with the medial axis image.
+ */
+template <typename TExecutor>
+bool testReducedMedialAxisBalls()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing medial axis balls in 3D ..." );
+
+  Z3i::Domain domain(Z3i::Point(0,0,0),Z3i::Point(22,12,9));
+  Z3i::DigitalSet set(domain);
+  for (unsigned int i = 0; i < 40; i++)
+    set.insert( Z3i::Point( rand()%23, rand()%13, rand()%10 ) );
+  DigitalSetDomain<Z3i::DigitalSet> setDomain(set); 
+
+  typedef ImageContainerBySTLMap<DigitalSetDomain<Z3i::DigitalSet> , DGtal::int64_t> Image;
+  Image image(setDomain);
+  for (Z3i::DigitalSet::ConstIterator it = set.begin(); it != set.end(); ++it)
+    image.setValue( *it, 1 + rand()%30 );
+
+  typedef PowerMap<Image, Z3i::L2PowerMetric> Power;
+  Z3i::L2PowerMetric l2power;
+  Power power(&domain, &image, &l2power);
+
+  //Serial scan
+  std::set<Z3i::Point> sites;
+  for (Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it)
+    if ( l2power.powerDistance( *it, power(*it), image( power(*it) ) ) < 0 )
+      sites.insert( power(*it) );
+
+  typedef ReducedMedialAxis<Power> MA;
+  MA::Balls balls;
+  MA::getReducedMedialAxisBallsFromPowerMap( power, balls, TExecutor() );
+  trace.info() << "balls: " << balls.size() << " / " << sites.size() << std::endl;
+
+  bool ok = ( balls.size() == sites.size() );
+  std::set<Z3i::Point>::const_iterator itSite = sites.begin();
+  for (MA::Balls::const_iterator it = balls.begin(); ok && (it != balls.end()); ++it, ++itSite)
+    ok = ( it->first == *itSite ) && ( it->second == image( *itSite ) );
+  nbok += ok ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "sorted balls == serial scan" << std::endl;
+
+  MA::Type rdma = MA::getReducedMedialAxisFromPowerMap( power );
+  ok = ( rdma.getPointer()->size() == sites.size() );
+  for (std::set<Z3i::Point>::const_iterator it = sites.begin(); 
+       ok && (it != sites.end()); ++it)
+    ok = ( rdma.getPointer()->find( *it ) != rdma.getPointer()->end() )
+      && ( rdma( *it ) == image( *it ) );
+  nbok += ok ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+	       << "medial axis image == serial scan" << std::endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -147,7 +211,12 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testReducedMedialAxis(); // && ... other tests
+  bool res = testReducedMedialAxis()
+    && testReducedMedialAxisBalls<SerialExecutor>()
+    && testReducedMedialAxisBalls<DefaultExecutor>(); // && ... other tests
+#ifdef CPP11_THREAD
+  res = res && testReducedMedialAxisBalls<ThreadPoolExecutor>();
+#endif
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
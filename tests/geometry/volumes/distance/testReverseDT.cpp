@@ -32,6 +32,8 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
 #include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
 #include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
 #include "DGtal/geometry/volumes/distance/ReverseDistanceTransformation.h"
@@ -268,6 +270,60 @@ bool testReverseDTL1()
   return nbok == nb;
 }
 
+/**
+ * Compares the shape rasterized by chunks with the executor
+ * @a TExecutor in a label image and in a boolean image with the sign
+ * of the reverse distance transformation.
+ */
+template <typename TExecutor>
+bool testRasterize()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing Reverse DT rasterization in 3D ..." );
+
+  //More than one chunk
+  Z3i::Domain domain( Z3i::Point(0,0,0), Z3i::Point(24,18,16) );
+  typedef ImageContainerBySTLMap<Z3i::Domain, DGtal::int64_t> Image;
+  Image image( domain );
+  for (unsigned int i = 0; i < 20; i++)
+    image.setValue( Z3i::Point( rand()%25, rand()%19, rand()%17 ), 1 + rand()%20 );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, Z3i::Vector> PowerImage;
+  typedef ReverseDistanceTransformation<Image, Z3i::L2PowerMetric, 
+                                        PowerImage, TExecutor> RDT;
+  Z3i::L2PowerMetric l2power;
+  RDT reverseDT( &domain, &image, &l2power );
+
+  ImageContainerBySTLVector<Z3i::Domain, unsigned char> labels( domain );
+  reverseDT.rasterize( labels, 2, 1 );
+  ImageContainerBySTLVector<Z3i::Domain, bool> bits( domain );
+  reverseDT.rasterize( bits, true, false );
+
+  bool okLabels = true, okBits = true;
+  unsigned int nbInside = 0;
+  for (Z3i::Domain::ConstIterator it = domain.begin(); it != domain.end(); ++it)
+    {
+      const bool inside = ( reverseDT( *it ) < 0 );
+      nbInside += inside ? 1 : 0;
+      okLabels = okLabels && ( labels( *it ) == (inside ? 2 : 1) );
+      okBits = okBits && ( bits( *it ) == inside );
+    }
+  trace.info() << "inside: " << nbInside << " / " << domain.size() << std::endl;
+
+  nbok += okLabels ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "labels == sign of the REDT" << std::endl;
+  nbok += okBits ? 1 : 0; 
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+         << "bits == sign of the REDT" << std::endl;
+  trace.endBlock();  
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -280,7 +336,12 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res = testReverseDT()
-    && testReverseDTL1(); // && ... other tests
+    && testReverseDTL1()
+    && testRasterize<SerialExecutor>()
+    && testRasterize<DefaultExecutor>(); // && ... other tests
+#ifdef CPP11_THREAD
+  res = res && testRasterize<ThreadPoolExecutor>();
+#endif
   
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
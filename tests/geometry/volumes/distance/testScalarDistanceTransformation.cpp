@@ -0,0 +1,201 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testScalarDistanceTransformation.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ScalarDistanceTransformation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/geometry/volumes/distance/ScalarDistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpPowerSeparableMetric.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ScalarDistanceTransformation.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Functor returning the square root of a squared distance as a float.
+ */
+struct SquareRoot
+{
+  float operator()(const DGtal::int64_t aSquaredDistance) const
+  {
+    return (float) std::sqrt( (double) aSquaredDistance );
+  }
+};
+
+/**
+ * Compares the scalar output with the sites given by the Voronoi map
+ * of DistanceTransformation.
+ */
+template <typename Space, DGtal::uint32_t p, typename Integer>
+bool testCompareWithVoronoiMap(const typename Space::Integer size,
+                               const typename Space::Size aBlockSize)
+{
+  typedef HyperRectDomain<Space> Domain;
+  typedef typename Space::Point Point;
+  typedef DigitalSetBySTLSet<Domain> Set;
+  typedef ExactPredicateLpSeparableMetric<Space, p> Metric;
+  typedef ExactPredicateLpPowerSeparableMetric<Space, p> PowerMetric;
+  typedef ImageContainerBySTLVector<Domain, Integer> Image;
+
+  Point low = Point::diagonal(-2), up = Point::diagonal(size);
+  up[0] += 5;
+  Domain domain(low, up);
+
+  Set set(domain);
+  for(typename Domain::ConstIterator it = domain.begin(), itend = domain.end();
+      it != itend; ++it)
+    if ( rand() % 30 != 0 )
+      set.insertNew( *it );
+
+  Metric metric;
+  PowerMetric powerMetric;
+  DistanceTransformation<Space, Set, Metric> dt(&domain, &set, &metric);
+
+  Image image(domain);
+  ScalarDistanceTransformation<Set, PowerMetric, Image>
+    sdt(domain, set, powerMetric, image, CastFunctor<Integer>(), aBlockSize);
+  trace.info() << sdt << std::endl;
+
+  bool ok = sdt.isValid();
+  for(typename Domain::ConstIterator it = domain.begin(), itend = domain.end();
+      it != itend; ++it)
+    ok = ok && ( image( *it ) == (Integer) powerMetric.powerDistance( *it, dt.getVoronoiVector( *it ), 0 ) )
+      && ( sdt( *it ) == image( *it ) );
+  return ok;
+}
+
+bool testScalarDistanceTransformation()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing squared distances ..." );
+
+  nbok += testCompareWithVoronoiMap<Z2i::Space, 2, DGtal::uint32_t>(50, 16) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "2D l_2 (uint32) == DistanceTransformation" << std::endl;
+
+  nbok += testCompareWithVoronoiMap<Z3i::Space, 2, DGtal::uint32_t>(20, 16) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "3D l_2 (uint32) == DistanceTransformation" << std::endl;
+
+  nbok += testCompareWithVoronoiMap<Z3i::Space, 2, DGtal::uint64_t>(20, 1) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "3D l_2 (uint64, row by row) == DistanceTransformation" << std::endl;
+
+  nbok += testCompareWithVoronoiMap<Z3i::Space, 3, DGtal::uint64_t>(20, 7) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "3D l_3 (uint64) == DistanceTransformation" << std::endl;
+
+  nbok += testCompareWithVoronoiMap<SpaceND<4>, 2, DGtal::uint32_t>(8, 3) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "4D l_2 (uint32) == DistanceTransformation" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testFloatDistances()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing float distances ..." );
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2;
+  typedef ExactPredicateLpPowerSeparableMetric<Z3i::Space, 2> PowerL2;
+  typedef ImageContainerBySTLVector<Z3i::Domain, float> Image;
+
+  Z3i::Domain domain( Z3i::Point(0,0,0), Z3i::Point(30,20,25) );
+  Z3i::DigitalSet set(domain);
+  for(Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+      it != itend; ++it)
+    if ( ( (*it) - Z3i::Point(15,10,12) ).norm() < 9 )
+      set.insertNew( *it );
+
+  L2 l2;
+  PowerL2 powerL2;
+  DistanceTransformation<Z3i::Space, Z3i::DigitalSet, L2> dt(&domain, &set, &l2);
+  Image image(domain);
+  ScalarDistanceTransformation<Z3i::DigitalSet, PowerL2, Image, SquareRoot>
+    sdt(domain, set, powerL2, image, SquareRoot());
+
+  bool ok = true;
+  for(Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+      it != itend; ++it)
+    ok = ok && ( std::fabs( image( *it ) - dt( *it ) ) < 1e-5 );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "float distances == DistanceTransformation" << std::endl;
+
+  //No site at all
+  Z3i::DigitalSet full(domain);
+  full.assignFromComplement( Z3i::DigitalSet(domain) );
+  ScalarDistanceTransformation<Z3i::DigitalSet, PowerL2, Image, SquareRoot>
+    sdtFull(domain, full, powerL2, image, SquareRoot());
+  nbok += ( image( Z3i::Point(3,4,5) ) == sdtFull.infinity() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "no site => infinity" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ScalarDistanceTransformation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testScalarDistanceTransformation() && testFloatDistances(); // && ... other tests
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
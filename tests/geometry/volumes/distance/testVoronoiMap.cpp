@@ -548,6 +548,150 @@ bool testSimple4D()
 }
 
 
+/**
+ * Brute force validation of a Voronoi map for any metric: the site
+ * of each point must be a site and no site may be closer.
+ */
+template <typename Set, typename Image, typename Metric>
+bool checkVoronoiBruteForce(const Set &aSites, const Image &voro,
+                            const Metric &aMetric)
+{
+  typedef typename Image::Point Point;
+
+  for(typename Image::Domain::ConstIterator it = voro.domain().begin(), itend = voro.domain().end();
+      it != itend; ++it)
+    {
+      const Point psite = voro(*it);
+      if ( aSites.find( psite ) == aSites.end() )
+        {
+          trace.error() << "Voro at " << *it << ": " << psite
+                        << " is not a site" << std::endl;
+          return false;
+        }
+      for(typename Set::ConstIterator itset = aSites.begin(), itendSet = aSites.end();
+          itset != itendSet; ++itset)
+        if ( aMetric.closest( *it, *itset, psite ) == ClosestFIRST )
+          {
+            trace.error() << "Voro at " << *it << ": " << psite
+                          << "  closer from set: " << *itset << std::endl;
+            return false;
+          }
+    }
+  return true;
+}
+
+/**
+ * The blocked separable passes must give a valid Voronoi map
+ * (checked by brute force) whatever the block size, and the same
+ * one as the row by row computation.
+ */
+template <typename Metric>
+bool testBlockSize3D(const Metric &aMetric)
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  Z3i::Point a(-3,0,2);
+  Z3i::Point b(34,20,15);
+  Z3i::Domain domain(a,b);
+
+  Z3i::DigitalSet mySet(domain);
+  Z3i::DigitalSet sites(domain);
+  for(Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+      it != itend; ++it)
+    if ( rand() % 50 != 0)
+      mySet.insertNew( *it );
+    else
+      sites.insertNew( *it );
+
+  typedef VoronoiMap<Z3i::Space, Z3i::DigitalSet, Metric> Voro;
+  trace.beginBlock("Row by row computation");
+  Voro voroRef(domain, mySet, aMetric, 1);
+  trace.endBlock();
+  nbok += checkVoronoiBruteForce( sites, voroRef, aMetric ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "row by row == brute force" << std::endl;
+
+  const Z3i::Space::Size sizes[] = { 2, 7, 16, 64 };
+  for(unsigned int i = 0; i < 4; ++i)
+    {
+      trace.beginBlock("Blocked computation");
+      Voro voro(domain, mySet, aMetric, sizes[i]);
+      trace.endBlock();
+
+      nbok += checkVoronoiBruteForce( sites, voro, aMetric ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "block size " << sizes[i] << " == brute force" << std::endl;
+
+      bool same = true;
+      for(Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+          it != itend; ++it)
+        same = same && ( voro(*it) == voroRef(*it) );
+      nbok += same ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "block size " << sizes[i] << " == row by row" << std::endl;
+    }
+  return nbok == nb;
+}
+
+bool testBlockSize()
+{
+  trace.beginBlock("Block sizes");
+  bool ok = testBlockSize3D( ExactPredicateLpSeparableMetric<Z3i::Space,2>() )
+    && testBlockSize3D( ExactPredicateLpSeparableMetric<Z3i::Space,3>() );
+  trace.endBlock();
+  return ok;
+}
+
+template <typename Executor>
+bool testExecutor3D()
+{
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space,2> L2Metric;
+  typedef ImageContainerBySTLVector<Z3i::Domain, Z3i::Vector> Storage;
+  L2Metric l2;
+
+  Z3i::Point a(-3,0,2);
+  Z3i::Point b(34,20,15);
+  Z3i::Domain domain(a,b);
+
+  Z3i::DigitalSet mySet(domain);
+  for(Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+      it != itend; ++it)
+    if ( rand() % 50 != 0)
+      mySet.insertNew( *it );
+
+  VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric, Storage, SerialExecutor> 
+    voroRef(domain, mySet, l2);
+  trace.beginBlock("Computation with the executor");
+  trace.info() << Executor() << std::endl;
+  VoronoiMap<Z3i::Space, Z3i::DigitalSet, L2Metric, Storage, Executor> 
+    voro(domain, mySet, l2, 3);
+  trace.endBlock();
+
+  bool same = true;
+  for(Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+      it != itend; ++it)
+    same = same && ( voro(*it) == voroRef(*it) );
+  trace.info() << "same as the serial computation: " << same << std::endl;
+  return same;
+}
+
+bool testExecutors()
+{
+  trace.beginBlock("Executors");
+  bool ok = testExecutor3D<OpenMPExecutor>()
+    && testExecutor3D<DefaultExecutor>();
+#ifdef CPP11_THREAD
+  ok = ok && testExecutor3D<ThreadPoolExecutor>();
+#endif
+  trace.endBlock();
+  return ok;
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -566,6 +710,8 @@ int main( int argc, char** argv )
     && testSimple3D() 
     && testSimpleRandom3D()
     && testSimple4D()
+    && testBlockSize()
+    && testExecutors()
     ; // && ... other tests
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
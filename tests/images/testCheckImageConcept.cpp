@@ -37,6 +37,11 @@
 #include "DGtal/images/ImageContainerByITKImage.h"
 #endif
 #include "DGtal/images/ImageContainerByHashTree.h"
+#include "DGtal/images/ImageContainerByBlockGrid.h"
+#include "DGtal/images/ImageContainerByCompressedTiles.h"
+#ifndef WIN32
+#include "DGtal/images/ImageContainerByMappedFile.h"
+#endif
 #include "DGtal/images/CImage.h"
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -77,6 +82,17 @@ bool testCheckImageConcept()
 
   BOOST_CONCEPT_ASSERT(( CImage< ImageHash >));
 
+  typedef ImageContainerByBlockGrid<Domain, int> ImageBlockGrid;
+  BOOST_CONCEPT_ASSERT(( CImage< ImageBlockGrid >));
+
+  typedef ImageContainerByCompressedTiles<Domain, int> ImageCompressedTiles;
+  BOOST_CONCEPT_ASSERT(( CImage< ImageCompressedTiles >));
+
+#ifndef WIN32
+  typedef ImageContainerByMappedFile<Domain, int> ImageMappedFile;
+  BOOST_CONCEPT_ASSERT(( CImage< ImageMappedFile >));
+#endif
+
   nbok += true ? 1 : 0; 
   nb++;
   trace.info() << "(" << nbok << "/" << nb << ") "
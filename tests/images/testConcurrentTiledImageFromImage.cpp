@@ -0,0 +1,309 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConcurrentTiledImageFromImage.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ConcurrentTiledImageFromImage.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include <new>
+#ifdef CPP11_THREAD
+#include <atomic>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ConcurrentTiledImageFromImage.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ConcurrentTiledImageFromImage.
+///////////////////////////////////////////////////////////////////////////////
+#ifdef CPP11_THREAD
+
+typedef ImageContainerBySTLVector<Z3i::Domain, int> VImage;
+typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+typedef ConcurrentTiledImageFromImage<VImage, MyImageFactoryFromImage> MyTiledImage;
+
+/**
+ * Random reads and writes from one thread, with a small cache.
+ */
+bool testSerial()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing ConcurrentTiledImageFromImage from one thread");
+
+    Z3i::Domain domain(Z3i::Point(-3,2,0), Z3i::Point(12,11,9));
+    VImage image(domain);
+    int i = 1;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+    VImage reference(image);
+
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+    {
+      MyTiledImage tiledImage(image, imageFactoryFromImage, 3, 4, MyTiledImage::Lexicographic, 0, 2);
+      trace.info() << tiledImage << endl;
+
+      // 16x10x10 domain, 3 tiles of 6x4x4 values per dimension (the last ones cropped)
+      Z3i::Domain tile = tiledImage.findSubDomain(Z3i::Point(12,2,9));
+      nbok += ((tile.lowerBound() == Z3i::Point(9,2,8)) && (tile.upperBound() == Z3i::Point(12,5,9))) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") " << "tile " << tile << endl;
+
+      bool ok = true;
+      for (unsigned int j = 0; j < 20000; ++j)
+      {
+        const Z3i::Point p(-3 + rand() % 16, 2 + rand() % 10, rand() % 10);
+        if (rand() % 2)
+        {
+          tiledImage.setValue(p, j);
+          reference.setValue(p, j);
+        }
+        else
+          ok = ok && (tiledImage(p) == reference(p));
+      }
+      nbok += ok ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "hits=" << tiledImage.nbHits() << " misses=" << tiledImage.nbMisses() << endl;
+
+      nbok += (tiledImage.nbHits() + tiledImage.nbMisses() == 20000) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+    }
+
+    // The destruction of the tiled image flushes the cache
+    nbok += std::equal(image.begin(), image.end(), reference.begin()) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+/**
+ * Each thread writes, then reads back, the points of its planes.
+ */
+struct Worker
+{
+  MyTiledImage * tiledImage;
+  unsigned int index;
+  unsigned int nbThreads;
+  bool ok;
+
+  void operator()()
+  {
+    const Z3i::Domain & domain = tiledImage->domain();
+    for (Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it)
+      if ((*it)[2] % nbThreads == index)
+        tiledImage->setValue(*it, (*it)[0] * 1000 + (*it)[1] * 10 + (*it)[2]);
+    for (Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it)
+      if ((*it)[2] % nbThreads == index)
+        ok = ok && ((*tiledImage)(*it) == (*it)[0] * 1000 + (*it)[1] * 10 + (*it)[2]);
+  }
+};
+
+/**
+ * Concurrent writes and reads, with or without the prefetcher.
+ */
+bool testConcurrent(MyTiledImage::TraversalOrder anOrder, unsigned int aPrefetchDistance)
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing ConcurrentTiledImageFromImage from several threads");
+
+    Z3i::Domain domain(Z3i::Point(0,0,0), Z3i::Point(31,31,31));
+    VImage image(domain);
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+    {
+      MyTiledImage tiledImage(image, imageFactoryFromImage, 4, 24, anOrder, aPrefetchDistance, 4);
+      trace.info() << tiledImage << endl;
+
+      const unsigned int nbThreads = 4;
+      std::vector<Worker> workers(nbThreads);
+      std::vector<std::thread> threads;
+      for (unsigned int t = 0; t < nbThreads; ++t)
+      {
+        workers[t].tiledImage = &tiledImage;
+        workers[t].index = t;
+        workers[t].nbThreads = nbThreads;
+        workers[t].ok = true;
+      }
+      for (unsigned int t = 0; t < nbThreads; ++t)
+        threads.push_back(std::thread(std::ref(workers[t])));
+      bool ok = true;
+      for (unsigned int t = 0; t < nbThreads; ++t)
+      {
+        threads[t].join();
+        ok = ok && workers[t].ok;
+      }
+      nbok += ok ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "hits=" << tiledImage.nbHits() << " misses=" << tiledImage.nbMisses()
+                   << " prefetched=" << tiledImage.nbPrefetched() << endl;
+
+      nbok += (tiledImage.nbHits() + tiledImage.nbMisses() == 2 * domain.size()) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+    }
+
+    bool ok = true;
+    for (Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it)
+      ok = ok && (image(*it) == (*it)[0] * 1000 + (*it)[1] * 10 + (*it)[2]);
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") " << "flushed values" << endl;
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+/**
+ * Factory whose first requests fail.
+ */
+struct FailingImageFactory : public MyImageFactoryFromImage
+{
+  std::atomic<int> nbFailures;
+
+  FailingImageFactory(VImage & anImage, const int aNbFailures)
+    : MyImageFactoryFromImage(anImage), nbFailures(aNbFailures)
+  {}
+
+  OutputImage * requestImage(const Domain & aDomain)
+  {
+    if (nbFailures-- > 0)
+      throw std::bad_alloc();
+    return MyImageFactoryFromImage::requestImage(aDomain);
+  }
+};
+
+typedef ConcurrentTiledImageFromImage<VImage, FailingImageFactory> FailingTiledImage;
+
+/**
+ * Reads a value, trying again after the errors of the factory.
+ */
+struct Reader
+{
+  FailingTiledImage * tiledImage;
+  int value;
+
+  void operator()()
+  {
+    for (int k = 0; (k < 10) && (value == -1); ++k)
+      try
+      {
+        value = (*tiledImage)(Z3i::Point(1,2,3));
+      }
+      catch (const std::bad_alloc &)
+      {
+      }
+  }
+};
+
+/**
+ * Errors of the factory: the threads waiting for the tile do not
+ * wait forever, and the tile is loaded by a later access.
+ */
+bool testFactoryErrors()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing ConcurrentTiledImageFromImage with factory errors");
+
+    Z3i::Domain domain(Z3i::Point(0,0,0), Z3i::Point(7,7,7));
+    VImage image(domain);
+    image.setValue(Z3i::Point(1,2,3), 5);
+    FailingImageFactory factory(image, 3);
+    {
+      FailingTiledImage tiledImage(image, factory, 2, 4);
+      const unsigned int nbThreads = 4;
+      std::vector<Reader> readers(nbThreads);
+      std::vector<std::thread> threads;
+      for (unsigned int t = 0; t < nbThreads; ++t)
+      {
+        readers[t].tiledImage = &tiledImage;
+        readers[t].value = -1;
+      }
+      for (unsigned int t = 0; t < nbThreads; ++t)
+        threads.push_back(std::thread(std::ref(readers[t])));
+      bool ok = true;
+      for (unsigned int t = 0; t < nbThreads; ++t)
+      {
+        threads[t].join();
+        ok = ok && (readers[t].value == 5);
+      }
+      nbok += ok ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") values read after the errors" << endl;
+    }
+
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
+#endif // CPP11_THREAD
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+    trace.beginBlock ( "Testing class ConcurrentTiledImageFromImage" );
+    trace.info() << "Args:";
+    for ( int i = 0; i < argc; ++i )
+        trace.info() << " " << argv[ i ];
+    trace.info() << endl;
+
+    bool res = true;
+#ifdef CPP11_THREAD
+    res = testSerial()
+      && testConcurrent(MyTiledImage::Lexicographic, 0)
+      && testConcurrent(MyTiledImage::Lexicographic, 4)
+      && testConcurrent(MyTiledImage::Slab, 1)
+      && testConcurrent(MyTiledImage::Morton, 4)
+      && testFactoryErrors();
+#else
+    trace.info() << "C++11 threads are not available." << endl;
+#endif
+    trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+    trace.endBlock();
+    return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
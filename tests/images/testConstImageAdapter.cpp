@@ -42,6 +42,8 @@
 #include "DGtal/base/BasicFunctors.h"
 #include "DGtal/images/ImageSelector.h"
 #include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/base/Clock.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -60,6 +62,15 @@ void displayRange(const R& r)
   trace.info() << std::endl; 
 }
 
+/// Affine rescaling of the values
+struct Rescale
+{
+  int operator()(const int & aValue) const
+  {
+    return 2 * aValue + 1;
+  }
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 int main( int argc, char** argv )
 {
@@ -152,6 +163,47 @@ int main( int argc, char** argv )
 
   trace.endBlock();
 
+  trace.beginBlock("Block evaluation");
+
+  //block of the thresholded image
+  Domain sub( Point(1,1), Point(3,4) ); 
+  std::vector<bool> block( sub.size() ); 
+  std::vector<bool>::iterator blockEnd = evaluateBlock( a, sub, block.begin() ); 
+  bool ok = ( blockEnd == block.end() ); 
+  std::vector<bool>::const_iterator b = block.begin(); 
+  for (Domain::ConstIterator itp = sub.begin(), itpEnd = sub.end(); itp != itpEnd; ++itp, ++b)
+    ok = ok && ( *b == a(*itp) ); 
+  nbok += ok ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") thresholded block" << endl; 
+
+  //copy of a rescaled image, per point and by blocks
+  typedef ConstImageAdapter<Image, Domain, DefaultFunctor, int, Rescale> RescaledImage; 
+  const Domain large( Point::diagonal(0), Point::diagonal(511) ); 
+  Image source( large ); 
+  int i = 0; 
+  for (Image::Iterator itv = source.begin(); itv != source.end(); ++itv)
+    *itv = i++ % 1000; 
+  Rescale rescale; 
+  RescaledImage rescaled( source, large, g, rescale ); 
+
+  Clock c; 
+  Image perPoint( large ); 
+  c.startClock(); 
+  for (Domain::ConstIterator itp = large.begin(), itpEnd = large.end(); itp != itpEnd; ++itp)
+    perPoint.setValue( *itp, rescaled(*itp) ); 
+  const double tPerPoint = c.stopClock(); 
+
+  Image byBlocks( large ); 
+  c.startClock(); 
+  imageFromConstImage( byBlocks, rescaled ); 
+  const double tBlocks = c.stopClock(); 
+
+  nbok += std::equal( perPoint.begin(), perPoint.end(), byBlocks.begin() ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") rescaled copy, per point: " 
+               << tPerPoint << " ms, by blocks: " << tBlocks << " ms" << endl; 
+
+  trace.endBlock();
+
   bool res = (nbok == nb);
   
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
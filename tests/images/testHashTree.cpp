@@ -41,8 +41,10 @@
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/ImageContainerByHashTree.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
 
 #include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/Executors.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -282,6 +284,109 @@ bool testBadKeySizes()
   return true;  
 }
 
+/**
+ * Bulk loading and bulk export compared with per point accesses.
+ *
+ */
+template <typename TExecutor>
+bool testBulkLoad()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef SpaceND<2> SpaceType;
+  typedef HyperRectDomain<SpaceType> TDomain;
+  typedef TDomain::Point Point;
+  typedef experimental::ImageContainerByHashTree<TDomain, int > Image;
+  typedef ImageContainerBySTLVector<TDomain, int> ImageVector;
+
+  trace.beginBlock ( "Bulk loading" );
+  TExecutor executor;
+  const TDomain domain( Point( 3, 5 ), Point( 200, 97 ) );
+  ImageVector source( domain );
+  for ( TDomain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    {
+      const Point & p = *it;
+      //Large homogeneous regions and a noisy band
+      int value = ( p[0] - 100 ) * ( p[0] - 100 ) + ( p[1] - 50 ) * ( p[1] - 50 ) < 1600 ? 30 : 10;
+      if ( ( p[0] > 150 ) && ( p[0] < 170 ) )
+        value = ( p[0] * 7 + p[1] * 13 ) % 5;
+      source.setValue( p, value );
+    }
+
+  Image image( 3, 8, 0 );
+  image.bulkLoad( source, executor );
+  trace.info() << image << endl;
+
+  bool result = true;
+  for ( TDomain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    result = result && ( image( *it ) == source( *it ) );
+  nbok += result ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "bulk loaded values" << endl;
+
+  //Same values as per point insertions, with merged leaves
+  Image reference( 3, 8, 0 );
+  for ( TDomain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    reference.setValue( *it, source( *it ) );
+  unsigned int nbLeaves = 0, nbReferenceLeaves = 0;
+  for ( Image::Iterator it = image.begin(); !it.isAtEnd(); ++it )
+    ++nbLeaves;
+  for ( Image::Iterator it = reference.begin(); !it.isAtEnd(); ++it )
+    ++nbReferenceLeaves;
+  nbok += ( nbLeaves <= nbReferenceLeaves ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "leaves=" << nbLeaves << " (per point insertions: "
+               << nbReferenceLeaves << ")" << endl;
+
+  //Constant image: a single leaf
+  ImageVector constant( domain );
+  for ( ImageVector::Iterator it = constant.begin(), itEnd = constant.end();
+        it != itEnd; ++it )
+    *it = 4;
+  image.bulkLoad( constant, executor );
+  nbLeaves = 0;
+  for ( Image::Iterator it = image.begin(); !it.isAtEnd(); ++it )
+    ++nbLeaves;
+  nbok += ( ( nbLeaves == 1 ) && ( image( Point( 10, 10 ) ) == 4 ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "constant image, leaves=" << nbLeaves << endl;
+  trace.endBlock();
+
+  trace.beginBlock ( "Bulk export" );
+  reference.bulkExport( constant, executor );
+  result = true;
+  for ( TDomain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    result = result && ( constant( *it ) == source( *it ) );
+  nbok += result ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "exported values" << endl;
+
+  //Default executor: sequential export in a map, which does not
+  //support concurrent writes
+  ImageContainerBySTLMap<TDomain, int> map( domain, 0 );
+  reference.bulkExport( map );
+  result = true;
+  for ( TDomain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    result = result && ( map( *it ) == source( *it ) );
+  nbok += result ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "values exported in an ImageContainerBySTLMap" << endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -293,7 +398,11 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testHashTree() && testHashTree2D() && testGetSetVal() && testBadKeySizes();  // && ... other tests
+  bool res = testHashTree() && testHashTree2D() && testGetSetVal() && testBadKeySizes()
+    && testBulkLoad<SerialExecutor>() && testBulkLoad<DefaultExecutor>();  // && ... other tests
+#ifdef CPP11_THREAD
+  res = res && testBulkLoad<ThreadPoolExecutor>();
+#endif
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -0,0 +1,210 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testHashTreeStorages-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of the node storages of ImageContainerByHashTree: memory
+ * per leaf and get/setValue throughput on a label volume.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/Executors.h"
+#include "DGtal/images/ImageContainerByHashTree.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include <boost/lexical_cast.hpp>
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace DGtal::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking the storages of ImageContainerByHashTree.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Label of a point: index of the first ball containing it (0 if
+ * none), which gives large constant regions as in the octree
+ * compressed label volumes.
+ */
+struct Labels
+{
+  std::vector<Z3i::Point> centers;
+  std::vector<Z3i::Integer> radii;
+
+  int operator()( const Z3i::Point & p ) const
+  {
+    for ( unsigned int i = 0; i < centers.size(); ++i )
+      if ( ( p - centers[i] ).norm( Z3i::Point::L_2 ) <= radii[i] )
+        return i + 1;
+    return 0;
+  }
+};
+
+template <typename Image>
+void runATest( const std::string & aName, const Z3i::Domain & aDomain,
+               const unsigned int aKeySize, const Labels & aLabels )
+{
+  trace.beginBlock( aName + ", hash key size "
+                    + boost::lexical_cast<string>( aKeySize ) );
+  Image image( aDomain, aKeySize, 0 );
+
+  //Keys and labels are computed first, so that only the tree
+  //accesses are timed.
+  std::vector<typename Image::HashKey> keys;
+  std::vector<int> values;
+  for ( Z3i::Domain::ConstIterator it = aDomain.begin(), itEnd = aDomain.end();
+        it != itEnd; ++it )
+    {
+      keys.push_back( image.getKey( *it ) );
+      values.push_back( aLabels( *it ) );
+    }
+
+  Clock c;
+  c.startClock();
+  for ( std::size_t i = 0; i < keys.size(); ++i )
+    image.setValue( keys[i], values[i] );
+  const double tSet = c.stopClock();
+
+  c.startClock();
+  long int sum = 0;
+  for ( unsigned int k = 0; k < 4; ++k )
+    for ( std::size_t i = 0; i < keys.size(); ++i )
+      sum += image.get( keys[i] );
+  const double tGet = c.stopClock() / 4;
+
+  const double nbPoints = (double) keys.size();
+  const unsigned int nbNodes = image.getNbNodes();
+  trace.info() << image << std::endl;
+  trace.info() << "checksum=" << sum << std::endl;
+  trace.info() << "memory per leaf: "
+               << (double) image.myStorage.memory() / nbNodes << " bytes"
+               << " (without the allocator overhead per node)" << std::endl;
+  trace.info() << "setValue: " << nbPoints / tSet / 1000.0 << " Mpoints/s"
+               << std::endl;
+  trace.info() << "get: " << nbPoints / tGet / 1000.0 << " Mpoints/s"
+               << std::endl;
+  trace.endBlock();
+}
+
+/**
+ * Bulk loading and bulk export compared with per point setValue()
+ * and operator().
+ */
+template <typename Image, typename TExecutor>
+void runBulkTest( const std::string & aName, const Z3i::Domain & aDomain,
+                  const Labels & aLabels )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> Dense;
+  trace.beginBlock( aName );
+  Dense dense( aDomain );
+  for ( Z3i::Domain::ConstIterator it = aDomain.begin(), itEnd = aDomain.end();
+        it != itEnd; ++it )
+    dense.setValue( *it, aLabels( *it ) );
+
+  TExecutor executor;
+  Clock c;
+  Image perPoint( aDomain, 16, 0 );
+  c.startClock();
+  for ( Z3i::Domain::ConstIterator it = aDomain.begin(), itEnd = aDomain.end();
+        it != itEnd; ++it )
+    perPoint.setValue( *it, dense( *it ) );
+  const double tSet = c.stopClock();
+
+  Image bulk( aDomain, 16, 0 );
+  c.startClock();
+  bulk.bulkLoad( dense, executor );
+  const double tLoad = c.stopClock();
+
+  c.startClock();
+  for ( Z3i::Domain::ConstIterator it = aDomain.begin(), itEnd = aDomain.end();
+        it != itEnd; ++it )
+    dense.setValue( *it, bulk( *it ) );
+  const double tGet = c.stopClock();
+
+  c.startClock();
+  bulk.bulkExport( dense, executor );
+  const double tExport = c.stopClock();
+
+  trace.info() << "leaves: " << bulk.getNbNodes() << " (per point setValue: "
+               << perPoint.getNbNodes() << ")" << std::endl;
+  trace.info() << "setValue per point: " << tSet << " ms, bulkLoad: "
+               << tLoad << " ms" << std::endl;
+  trace.info() << "operator() per point: " << tGet << " ms, bulkExport: "
+               << tExport << " ms" << std::endl;
+  trace.endBlock();
+}
+
+/**
+ * The storage is protected: the benchmark reads its memory through
+ * this derived class.
+ */
+template <typename TStorage>
+struct BenchImage
+  : public ImageContainerByHashTree<Z3i::Domain, int, DGtal::uint64_t, TStorage>
+{
+  typedef ImageContainerByHashTree<Z3i::Domain, int, DGtal::uint64_t, TStorage> Base;
+  BenchImage( const Z3i::Domain & aDomain, const unsigned int aKeySize,
+              const int aDefault )
+    : Base( aDomain, aKeySize, aDefault )
+  {}
+  using Base::myStorage;
+};
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking the storages of ImageContainerByHashTree" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  typedef BenchImage< LinkedHashTreeStorage<DGtal::uint64_t, int> > LinkedImage;
+  typedef BenchImage< OpenAddressingHashTreeStorage<DGtal::uint64_t, int> > OpenImage;
+
+  const Z3i::Integer size = 128;
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) );
+  Labels labels;
+  for ( unsigned int i = 0; i < 20; ++i )
+    {
+      labels.centers.push_back( Z3i::Point( rand() % size, rand() % size, rand() % size ) );
+      labels.radii.push_back( 5 + rand() % ( size / 4 ) );
+    }
+
+  runATest<LinkedImage>( "Linked buckets", domain, 12, labels );
+  runATest<LinkedImage>( "Linked buckets", domain, 16, labels );
+  runATest<OpenImage>( "Open addressing", domain, 3, labels );
+  runATest<OpenImage>( "Open addressing", domain, 16, labels );
+
+  runBulkTest<OpenImage, SerialExecutor>( "Bulk loading, serial", domain, labels );
+  runBulkTest<OpenImage, DefaultExecutor>( "Bulk loading, default executor", domain, labels );
+
+  trace.endBlock();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
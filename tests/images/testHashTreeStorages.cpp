@@ -0,0 +1,180 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testHashTreeStorages.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing the node storages of ImageContainerByHashTree.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/HashTreeStorages.h"
+#include "DGtal/images/ImageContainerByHashTree.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+using namespace DGtal::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the storages of ImageContainerByHashTree.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Random insertions and removals compared with a std::map.
+ */
+template <typename Storage>
+bool testStorage( const unsigned int keySize )
+{
+  typedef typename Storage::Node Node;
+  typedef typename Storage::Iterator Iterator;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing a storage against std::map" );
+
+  Storage storage( keySize );
+  std::map<DGtal::uint64_t, int> reference;
+  bool ok = true;
+  for ( unsigned int i = 0; ( i < 20000 ) && ok; ++i )
+    {
+      const DGtal::uint64_t key = 1 + rand() % 3000;
+      Node* n = storage.find( key );
+      ok = ( n != 0 ) == ( reference.count( key ) == 1 );
+      if ( rand() % 3 == 0 )
+        {
+          ok = ok && ( storage.remove( key ) == ( n != 0 ) );
+          reference.erase( key );
+        }
+      else if ( n )
+        {
+          ok = ok && ( n->getObject() == reference[ key ] );
+          n->getObject() = i;
+          reference[ key ] = i;
+        }
+      else
+        {
+          n = storage.insert( key, i );
+          ok = ok && ( n->getKey() == key ) && ( n->getObject() == (int) i );
+          reference[ key ] = i;
+        }
+    }
+  nbok += ok ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << ++nb << ") random insert/remove/find" << std::endl;
+
+  ok = storage.size() == reference.size();
+  for ( std::map<DGtal::uint64_t, int>::const_iterator it = reference.begin();
+        it != reference.end(); ++it )
+    {
+      Node* n = storage.find( it->first );
+      ok = ok && n && ( n->getObject() == it->second );
+    }
+  std::size_t count = 0;
+  for ( Iterator it = storage.begin(); it != storage.end(); ++it, ++count )
+    ok = ok && ( reference.count( it.getKey() ) == 1 ) && ( *it == reference[ it.getKey() ] );
+  ok = ok && ( count == reference.size() );
+  nbok += ok ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << ++nb << ") final content, "
+               << storage.size() << " nodes, " << storage.nbBuckets() << " buckets, "
+               << "average collisions=" << storage.averageCollisions()
+               << " max collisions=" << storage.maxCollisions() << std::endl;
+
+  Storage copy( storage );
+  storage.remove( reference.begin()->first );
+  ok = ( copy.size() == reference.size() ) &&
+    ( copy.find( reference.begin()->first ) != 0 ) &&
+    ( storage.find( reference.begin()->first ) == 0 );
+  nbok += ok ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << ++nb << ") deep copy" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Same random writes in two hash trees using different storages.
+ */
+bool testHashTreeWithStorages()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing ImageContainerByHashTree with both storages" );
+
+  typedef ImageContainerByHashTree<Z3i::Domain, int, DGtal::uint64_t,
+                                   LinkedHashTreeStorage<DGtal::uint64_t, int> > LinkedImage;
+  typedef ImageContainerByHashTree<Z3i::Domain, int> OpenImage;
+
+  Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 15, 15, 15 ) );
+  LinkedImage linked( domain, 3, 0 );
+  OpenImage open( domain, 3, 0 );
+  for ( unsigned int i = 0; i < 3000; ++i )
+    {
+      Z3i::Point p( rand() % 16, rand() % 16, rand() % 16 );
+      const int v = rand() % 3;
+      linked.setValue( p, v );
+      open.setValue( p, v );
+    }
+
+  bool ok = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+        it != itEnd; ++it )
+    ok = ok && ( linked( *it ) == open( *it ) );
+  nbok += ok ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << ++nb << ") same values" << std::endl;
+
+  nbok += ( linked.getNbNodes() == open.getNbNodes() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << ++nb << ") same number of nodes: "
+               << linked.getNbNodes() << std::endl;
+  trace.info() << linked << std::endl;
+  trace.info() << open << std::endl;
+
+  nbok += ( open.checkIntegrity() && linked.checkIntegrity() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << ++nb << ") integrity" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing the storages of ImageContainerByHashTree" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testStorage< LinkedHashTreeStorage<DGtal::uint64_t, int> >( 6 )
+    && testStorage< OpenAddressingHashTreeStorage<DGtal::uint64_t, int> >( 1 )
+    && testStorage< OpenAddressingHashTreeStorage<DGtal::uint32_t, int> >( 4 )
+    && testHashTreeWithStorages();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
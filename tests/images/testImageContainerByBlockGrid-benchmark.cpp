@@ -0,0 +1,223 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByBlockGrid-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmark of ImageContainerByBlockGrid against ImageContainerBySTLMap
+ * and ImageContainerByHashTree on sparse images.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerByHashTree.h"
+#include "DGtal/images/ImageContainerByBlockGrid.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking ImageContainerByBlockGrid.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLMap<Z3i::Domain, int> MapImage;
+typedef ImageContainerByBlockGrid<Z3i::Domain, int> GridImage;
+typedef ImageContainerByBlockGrid<Z3i::Domain, int, 2> SmallGridImage;
+
+/**
+ * The storage is protected: the benchmark reads its memory through
+ * this derived class.
+ */
+struct HashImage
+  : public experimental::ImageContainerByHashTree<Z3i::Domain, int>
+{
+  typedef experimental::ImageContainerByHashTree<Z3i::Domain, int> Base;
+  HashImage( const Z3i::Domain & aDomain )
+    : Base( aDomain, 16, 0 )
+  {}
+  std::size_t memory() const
+  {
+    return myStorage.memory();
+  }
+};
+
+/// @return the memory of a map image (nodes of 32 bytes plus the pairs).
+std::size_t memory( const MapImage & anImage )
+{
+  return anImage.size() * ( 32 + sizeof( MapImage::value_type ) );
+}
+
+/// @return the memory of a hash tree image.
+std::size_t memory( const HashImage & anImage )
+{
+  return anImage.memory();
+}
+
+/// @return the memory of a block grid image.
+template <unsigned int TBlockLog2>
+std::size_t memory( const ImageContainerByBlockGrid<Z3i::Domain, int, TBlockLog2> & anImage )
+{
+  return anImage.memory();
+}
+
+/// Sum of the 6-neighbourhood values, through operator().
+template <typename Image>
+long int neighbourhoodSum( const Image & anImage, const std::vector<Z3i::Point> & somePoints )
+{
+  long int sum = 0;
+  for ( std::size_t i = 0; i < somePoints.size(); ++i )
+    for ( Dimension d = 0; d < 3; ++d )
+      {
+        Z3i::Point p = somePoints[ i ];
+        --p[ d ];
+        if ( anImage.domain().isInside( p ) )
+          sum += anImage( p );
+        p[ d ] += 2;
+        if ( anImage.domain().isInside( p ) )
+          sum += anImage( p );
+      }
+  return sum;
+}
+
+/// Sum of the 6-neighbourhood values, through an accessor.
+template <unsigned int TBlockLog2>
+long int neighbourhoodSum( const ImageContainerByBlockGrid<Z3i::Domain, int, TBlockLog2> & anImage,
+                           const std::vector<Z3i::Point> & somePoints )
+{
+  typename ImageContainerByBlockGrid<Z3i::Domain, int, TBlockLog2>::ConstAccessor accessor( anImage );
+  long int sum = 0;
+  for ( std::size_t i = 0; i < somePoints.size(); ++i )
+    for ( Dimension d = 0; d < 3; ++d )
+      {
+        Z3i::Point p = somePoints[ i ];
+        --p[ d ];
+        if ( anImage.domain().isInside( p ) )
+          sum += accessor( p );
+        p[ d ] += 2;
+        if ( anImage.domain().isInside( p ) )
+          sum += accessor( p );
+      }
+  return sum;
+}
+
+/**
+ * Writes the values at the given points, then reads them back and
+ * reads their 6-neighbourhoods.
+ */
+template <typename Image>
+void runATest( const std::string & aName, const Z3i::Domain & aDomain,
+               const std::vector<Z3i::Point> & somePoints,
+               const std::vector<int> & someValues )
+{
+  trace.beginBlock( aName );
+  Image image( aDomain );
+  Clock c;
+
+  c.startClock();
+  for ( std::size_t i = 0; i < somePoints.size(); ++i )
+    image.setValue( somePoints[ i ], someValues[ i ] );
+  const double tSet = c.stopClock();
+
+  c.startClock();
+  long int sum = 0;
+  for ( std::size_t i = 0; i < somePoints.size(); ++i )
+    sum += image( somePoints[ i ] );
+  const double tGet = c.stopClock();
+
+  c.startClock();
+  const long int sumNeighbours = neighbourhoodSum( image, somePoints );
+  const double tNeighbours = c.stopClock();
+
+  const double nbPoints = (double) somePoints.size();
+  trace.info() << "checksums=" << sum << " " << sumNeighbours << std::endl;
+  trace.info() << "memory per point: " << (double) memory( image ) / nbPoints
+               << " bytes" << std::endl;
+  trace.info() << "setValue: " << nbPoints / tSet / 1000.0 << " Mpoints/s" << std::endl;
+  trace.info() << "operator(): " << nbPoints / tGet / 1000.0 << " Mpoints/s" << std::endl;
+  trace.info() << "6-neighbourhoods: " << nbPoints / tNeighbours / 1000.0 << " Mpoints/s" << std::endl;
+  trace.endBlock();
+}
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Benchmarking ImageContainerByBlockGrid on sparse images" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  const Z3i::Integer size = 256;
+  Z3i::Domain domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) );
+
+  // Narrow band (width 3) around a sphere, valued by the rounded
+  // distance to the sphere.
+  std::vector<Z3i::Point> points;
+  std::vector<int> values;
+  const Z3i::Point center = Z3i::Point::diagonal( size / 2 );
+  const double radius = size / 3.0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    {
+      const double d = ( *it - center ).norm() - radius;
+      if ( std::fabs( d ) <= 1.5 )
+        {
+          points.push_back( *it );
+          values.push_back( (int) std::floor( d + 2.5 ) );
+        }
+    }
+  trace.info() << "Narrow band: " << points.size() << " points" << std::endl;
+  runATest<MapImage>( "Narrow band, STLMap", domain, points, values );
+  runATest<HashImage>( "Narrow band, HashTree", domain, points, values );
+  runATest<GridImage>( "Narrow band, BlockGrid (8^3 blocks)", domain, points, values );
+  runATest<SmallGridImage>( "Narrow band, BlockGrid (4^3 blocks)", domain, points, values );
+
+  // Sparse labels: small random balls
+  points.clear();
+  values.clear();
+  for ( unsigned int i = 0; i < 2000; ++i )
+    {
+      const Z3i::Point c( 2 + rand() % ( size - 4 ), 2 + rand() % ( size - 4 ), 2 + rand() % ( size - 4 ) );
+      const Z3i::Domain ball( c - Z3i::Point::diagonal( 2 ), c + Z3i::Point::diagonal( 2 ) );
+      for ( Z3i::Domain::ConstIterator it = ball.begin(), itEnd = ball.end(); it != itEnd; ++it )
+        if ( ( *it - c ).norm() <= 2 )
+          {
+            points.push_back( *it );
+            values.push_back( i + 1 );
+          }
+    }
+  trace.info() << "Sparse labels: " << points.size() << " points" << std::endl;
+  runATest<MapImage>( "Sparse labels, STLMap", domain, points, values );
+  runATest<HashImage>( "Sparse labels, HashTree", domain, points, values );
+  runATest<GridImage>( "Sparse labels, BlockGrid (8^3 blocks)", domain, points, values );
+  runATest<SmallGridImage>( "Sparse labels, BlockGrid (4^3 blocks)", domain, points, values );
+
+  trace.endBlock();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,231 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByBlockGrid.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ImageContainerByBlockGrid.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByBlockGrid.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByBlockGrid.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Random sparse writes, compared to an STLVector image.
+ */
+template <typename Domain, unsigned int TBlockLog2>
+bool testValues( const Domain & aDomain )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef ImageContainerByBlockGrid<Domain, int, TBlockLog2> Image;
+  typedef ImageContainerBySTLVector<Domain, int> Reference;
+  typedef typename Domain::Point Point;
+
+  trace.beginBlock ( "Testing values of ImageContainerByBlockGrid" );
+
+  Image image( aDomain, -1 );
+  Reference reference( aDomain );
+  for ( typename Reference::Iterator it = reference.begin(); it != reference.end(); ++it )
+    *it = -1;
+
+  const Point extent = aDomain.upperBound() - aDomain.lowerBound() + Point::diagonal( 1 );
+  for ( unsigned int i = 0; i < 2000; ++i )
+    {
+      Point p;
+      for ( Dimension d = 0; d < Domain::dimension; ++d )
+        p[ d ] = aDomain.lowerBound()[ d ] + rand() % extent[ d ];
+      image.setValue( p, i );
+      reference.setValue( p, i );
+    }
+  // the background value does not allocate
+  const unsigned int nbBlocks = image.nbBlocks();
+  image.setValue( aDomain.upperBound(), image( aDomain.upperBound() ) );
+  nbok += ( image.nbBlocks() == nbBlocks ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << image << endl;
+
+  bool ok = true;
+  for ( typename Domain::ConstIterator it = aDomain.begin(), itEnd = aDomain.end();
+        it != itEnd; ++it )
+    ok = ok && ( image( *it ) == reference( *it ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") operator()" << endl;
+
+  // accessors, along the domain scan
+  typename Image::ConstAccessor accessor( image );
+  ok = true;
+  for ( typename Domain::ConstIterator it = aDomain.begin(), itEnd = aDomain.end();
+        it != itEnd; ++it )
+    ok = ok && ( accessor( *it ) == reference( *it ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") ConstAccessor" << endl;
+
+  typename Image::Accessor writer( image );
+  for ( typename Domain::ConstIterator it = aDomain.begin(), itEnd = aDomain.end();
+        it != itEnd; ++it )
+    if ( ( *it )[ 0 ] == aDomain.lowerBound()[ 0 ] )
+      {
+        writer.setValue( *it, 7 );
+        reference.setValue( *it, 7 );
+      }
+  ok = true;
+  for ( typename Domain::ConstIterator it = aDomain.begin(), itEnd = aDomain.end();
+        it != itEnd; ++it )
+    ok = ok && ( writer( *it ) == reference( *it ) ) && ( image( *it ) == reference( *it ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") Accessor" << endl;
+
+  // blocks visit every non background value once
+  unsigned int nbValues = 0;
+  unsigned int nbReference = 0;
+  for ( typename Image::BlockConstIterator it = image.blockBegin(), itEnd = image.blockEnd();
+        it != itEnd; ++it )
+    {
+      const Domain block = it.domain();
+      for ( typename Domain::ConstIterator p = block.begin(), pEnd = block.end(); p != pEnd; ++p )
+        nbValues += ( it( *p ) != -1 ) ? 1 : 0;
+    }
+  for ( typename Reference::ConstIterator it = reference.begin(); it != reference.end(); ++it )
+    nbReference += ( *it != -1 ) ? 1 : 0;
+  nbok += ( nbValues == nbReference ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbValues << " values in the blocks, " << nbReference << " expected" << endl;
+
+  // blocks restricted to a sub-domain
+  Point half;
+  for ( Dimension d = 0; d < Domain::dimension; ++d )
+    half[ d ] = extent[ d ] / 2;
+  const Domain subDomain( aDomain.lowerBound() + Point::diagonal( 3 ),
+                          aDomain.lowerBound() + half );
+  nbValues = 0;
+  nbReference = 0;
+  for ( typename Image::BlockConstIterator it = image.blockBegin( subDomain ), itEnd = image.blockEnd();
+        it != itEnd; ++it )
+    {
+      const Domain block = it.domain();
+      for ( typename Domain::ConstIterator p = block.begin(), pEnd = block.end(); p != pEnd; ++p )
+        nbValues += ( it( *p ) != -1 ) ? 1 : 0;
+    }
+  for ( typename Domain::ConstIterator it = subDomain.begin(), itEnd = subDomain.end();
+        it != itEnd; ++it )
+    nbReference += ( reference( *it ) != -1 ) ? 1 : 0;
+  nbok += ( nbValues == nbReference ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << nbValues << " values in the sub-domain blocks, " << nbReference << " expected" << endl;
+
+  // prune the blocks reset to the background value
+  for ( typename Domain::ConstIterator it = aDomain.begin(), itEnd = aDomain.end();
+        it != itEnd; ++it )
+    if ( ( *it )[ 0 ] - aDomain.lowerBound()[ 0 ] < (int) Image::blockSide )
+      {
+        image.setValue( *it, -1 );
+        reference.setValue( *it, -1 );
+      }
+  const unsigned int nbPruned = image.prune();
+  ok = image.isValid() && ( nbPruned > 0 );
+  for ( typename Domain::ConstIterator it = aDomain.begin(), itEnd = aDomain.end();
+        it != itEnd; ++it )
+    ok = ok && ( image( *it ) == reference( *it ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << nbPruned << " pruned blocks, " << image << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Concept check and range.
+ */
+bool testConcept()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing ImageContainerByBlockGrid range" );
+
+  typedef ImageContainerByBlockGrid<Z2i::Domain, int> Image;
+  BOOST_CONCEPT_ASSERT(( CImage<Image> ));
+
+  Z2i::Domain domain( Z2i::Point( -5, -5 ), Z2i::Point( 20, 10 ) );
+  Image image( domain );
+  int i = 0;
+  Image::Range::OutputIterator out = image.range().outputIterator();
+  for ( Z2i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it, ++i )
+    *out++ = ( i % 10 == 0 ) ? i : 0;
+
+  bool ok = true;
+  i = 0;
+  Image::ConstRange r = image.constRange();
+  for ( Image::ConstRange::ConstIterator it = r.begin(), itEnd = r.end(); it != itEnd; ++it, ++i )
+    ok = ok && ( *it == ( ( i % 10 == 0 ) ? i : 0 ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << image << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ImageContainerByBlockGrid" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testValues<Z3i::Domain, 3>( Z3i::Domain( Z3i::Point( -7, 2, 0 ), Z3i::Point( 40, 29, 33 ) ) )
+    && testValues<Z2i::Domain, 2>( Z2i::Domain( Z2i::Point( 3, -10 ), Z2i::Point( 100, 60 ) ) )
+    && testConcept();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
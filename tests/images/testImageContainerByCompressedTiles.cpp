@@ -0,0 +1,430 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByCompressedTiles.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ImageContainerByCompressedTiles and the
+ * tile codecs.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <boost/scoped_array.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Executors.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByCompressedTiles.h"
+#include "DGtal/images/TileCodecs.h"
+#include "DGtal/images/TiledImageFromImage.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByCompressedTiles.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Encodes and decodes some values, and reads each of them with at().
+ */
+template <typename TCodec>
+bool roundtrip( const std::vector<typename TCodec::Value> & someValues )
+{
+  typedef typename TCodec::Value Value;
+  const std::size_t n = someValues.size();
+  boost::scoped_array<Value> values( new Value[ n ] );
+  std::copy( someValues.begin(), someValues.end(), values.get() );
+
+  std::vector<unsigned char> code;
+  TCodec::encode( values.get(), n, code );
+  boost::scoped_array<Value> decoded( new Value[ n ] );
+  TCodec::decode( &code[ 0 ], decoded.get(), n );
+  bool ok = std::equal( values.get(), values.get() + n, decoded.get() );
+  for ( std::size_t i = 0; i < n; ++i )
+    ok = ok && ( TCodec::at( &code[ 0 ], n, i ) == values[ i ] );
+  return ok;
+}
+
+/**
+ * Roundtrips of a codec on constant, binary, periodic, noisy and
+ * short sequences.
+ */
+template <typename TCodec>
+bool testCodec( const std::string & aName )
+{
+  typedef typename TCodec::Value Value;
+  std::vector< std::vector<Value> > sequences;
+  sequences.push_back( std::vector<Value>( 1, Value( 1 ) ) );
+  sequences.push_back( std::vector<Value>( 1000, Value( 1 ) ) );
+  std::vector<Value> v;
+  for ( unsigned int i = 0; i < 1000; ++i )
+    v.push_back( Value( ( i / 37 ) % 2 ) );
+  sequences.push_back( v );
+  v.clear();
+  for ( unsigned int i = 0; i < 1000; ++i )
+    v.push_back( Value( ( i % 13 ) * 3 ) );
+  sequences.push_back( v );
+  v.clear();
+  unsigned int x = 12345;
+  for ( unsigned int i = 0; i < 1000; ++i )
+    {
+      x = x * 1103515245u + 12345u;
+      v.push_back( Value( ( x >> 16 ) % 7 ) );
+    }
+  sequences.push_back( v );
+  v.resize( 5 );
+  sequences.push_back( v );
+
+  bool ok = true;
+  for ( unsigned int i = 0; i < sequences.size(); ++i )
+    ok = ok && roundtrip<TCodec>( sequences[ i ] );
+  trace.info() << aName << ( ok ? " ok" : " failed" ) << endl;
+  return ok;
+}
+
+bool testCodecs()
+{
+  trace.beginBlock ( "Testing the tile codecs" );
+  bool ok = testCodec< RLETileCodec<int> >( "RLE<int>" )
+    && testCodec< RLETileCodec<double> >( "RLE<double>" )
+    && testCodec< BitPackingTileCodec<int> >( "BitPacking<int>" )
+    && testCodec< BitPackingTileCodec<unsigned char> >( "BitPacking<unsigned char>" )
+    && testCodec< BitPackingTileCodec<bool> >( "BitPacking<bool>" )
+    && testCodec< LZTileCodec<int> >( "LZ<int>" )
+    && testCodec< LZTileCodec<unsigned char> >( "LZ<unsigned char>" )
+    && testCodec< AdaptiveTileCodec<int> >( "Adaptive<int>" )
+    && testCodec< AdaptiveTileCodec<bool> >( "Adaptive<bool>" )
+    && testCodec< AdaptiveTileCodec<double> >( "Adaptive<double>" );
+  trace.endBlock();
+  return ok;
+}
+
+/**
+ * Values written point by point and by sub-domains, compared to an
+ * ImageContainerBySTLVector.
+ */
+template <typename TCodec>
+bool testValues( const std::string & aName )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing ImageContainerByCompressedTiles with " + aName );
+
+  typedef ImageContainerByCompressedTiles<Z3i::Domain, int, TCodec> TilesImage;
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> VImage;
+  BOOST_CONCEPT_ASSERT(( CImage<TilesImage> ));
+
+  // 23x17x11 domain, tiles of 8x8x4 (the last ones cropped)
+  const Z3i::Domain domain( Z3i::Point( -3, 2, 1 ), Z3i::Point( 19, 18, 11 ) );
+  TilesImage image( domain, Z3i::Vector( 8, 8, 4 ), 3 );
+  VImage reference( domain );
+  std::fill( reference.begin(), reference.end(), 3 );
+  trace.info() << image << endl;
+  nbok += ( image.isValid() && image.nbTiles() == 3 * 3 * 3 ) ? 1 : 0;
+  nb++;
+
+  bool ok = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    ok = ok && ( image( *it ) == 3 );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") background" << endl;
+
+  // Labels of balls, point by point
+  const Z3i::Point center( 6, 9, 6 );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    if ( ( *it - center ).norm() < 5 )
+      {
+        const int label = ( (*it)[ 0 ] < center[ 0 ] ) ? 1 : 2;
+        image.setValue( *it, label );
+        reference.setValue( *it, label );
+      }
+
+  // Ramp on a sub-domain spanning several tiles
+  const Z3i::Domain sub( Z3i::Point( 2, 5, 3 ), Z3i::Point( 17, 13, 9 ) );
+  std::vector<int> values( sub.size() );
+  for ( unsigned int i = 0; i < values.size(); ++i )
+    values[ i ] = i % 5;
+  image.setValues( sub, values.begin() );
+  std::vector<int>::const_iterator v = values.begin();
+  for ( Z3i::Domain::ConstIterator it = sub.begin(), itEnd = sub.end(); it != itEnd; ++it, ++v )
+    reference.setValue( *it, *v );
+
+  ok = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    ok = ok && ( image( *it ) == reference( *it ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") setValue and setValues" << endl;
+
+  std::vector<int> all( domain.size() );
+  image.getValues( domain, all.begin() );
+  const Z3i::Domain other( Z3i::Point( -1, 3, 1 ), Z3i::Point( 8, 16, 6 ) );
+  std::vector<int> some( other.size() );
+  image.getValues( other, some.begin() );
+  ok = std::equal( all.begin(), all.end(), reference.begin() );
+  v = some.begin();
+  for ( Z3i::Domain::ConstIterator it = other.begin(), itEnd = other.end(); it != itEnd; ++it, ++v )
+    ok = ok && ( *v == reference( *it ) );
+  typename TilesImage::ConstRange r = image.constRange();
+  ok = ok && std::equal( r.begin(), r.end(), reference.begin() );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") getValues and constRange" << endl;
+
+  // Points of two tiles written alternately: the tile leaving the
+  // cache is encoded
+  const Z3i::Point p( -3, 2, 1 );
+  const Z3i::Point q( 19, 18, 11 );
+  image.setValue( p, 8 );
+  image.setValue( q, 9 );
+  ok = ( image( p ) == 8 ) && ( image( q ) == 9 );
+  image.setValue( p, image( q ) + 1 );
+  image.getValues( domain, all.begin() );
+  reference.setValue( p, 10 );
+  reference.setValue( q, 9 );
+  ok = ok && std::equal( all.begin(), all.end(), reference.begin() );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") cached tile" << endl;
+
+  trace.info() << image << endl;
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Compressed image accessed through a TiledImageFromImage whose pages
+ * are its tiles.
+ */
+bool testTiledImage()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing TiledImageFromImage on ImageContainerByCompressedTiles" );
+
+  typedef ImageContainerByCompressedTiles<Z2i::Domain, int> TilesImage2;
+  typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+
+  // 11x10 domain, 3 tiles per dimension
+  const Z2i::Domain domain( Z2i::Point( -3, 2 ), Z2i::Point( 7, 11 ) );
+  TilesImage2 image( domain, Z2i::Vector( 4, 4 ) );
+  VImage reference( domain );
+  int i = 1;
+  for ( VImage::Iterator it = reference.begin(); it != reference.end(); ++it )
+    *it = ( i++ ) / 7;
+  image.setValues( domain, reference.begin() );
+
+  typedef ImageFactoryFromImage<TilesImage2> MyImageFactoryFromImage;
+  typedef MyImageFactoryFromImage::OutputImage OutputImage;
+  MyImageFactoryFromImage imageFactoryFromImage( image );
+
+  {
+    typedef ImageCacheReadPolicyFIFO<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyFIFO;
+    typedef ImageCacheWritePolicyWT<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWT;
+    MyImageCacheReadPolicyFIFO imageCacheReadPolicyFIFO( imageFactoryFromImage, 2 );
+    MyImageCacheWritePolicyWT imageCacheWritePolicyWT( imageFactoryFromImage );
+    typedef TiledImageFromImage<TilesImage2, MyImageFactoryFromImage,
+                                MyImageCacheReadPolicyFIFO, MyImageCacheWritePolicyWT> MyTiledImageFromImage;
+    MyTiledImageFromImage tiledImage( image, imageFactoryFromImage,
+                                      imageCacheReadPolicyFIFO, imageCacheWritePolicyWT, 3 );
+
+    bool ok = true;
+    for ( Z2i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+      ok = ok && ( tiledImage( *it ) == reference( *it ) );
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") read through the cache" << endl;
+
+    tiledImage.setValue( Z2i::Point( 7, 11 ), -1 );
+    nbok += ( image( Z2i::Point( 7, 11 ) ) == -1 ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") write-through" << endl;
+  }
+
+  {
+    typedef ImageCacheReadPolicyLRU<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyLRU;
+    typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWB;
+    MyImageCacheReadPolicyLRU imageCacheReadPolicyLRU( imageFactoryFromImage, domain, 3, 2 );
+    MyImageCacheWritePolicyWB imageCacheWritePolicyWB( imageFactoryFromImage );
+    typedef TiledImageFromImage<TilesImage2, MyImageFactoryFromImage,
+                                MyImageCacheReadPolicyLRU, MyImageCacheWritePolicyWB> MyTiledImageFromImage;
+    MyTiledImageFromImage tiledImage( image, imageFactoryFromImage,
+                                      imageCacheReadPolicyLRU, imageCacheWritePolicyWB, 3 );
+
+    for ( Z2i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+      tiledImage.setValue( *it, tiledImage( *it ) + 1 );
+    tiledImage.flush();
+  }
+  bool ok = true;
+  reference.setValue( Z2i::Point( 7, 11 ), -1 );
+  for ( Z2i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    ok = ok && ( image( *it ) == reference( *it ) + 1 );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") write-back" << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Task reading the rows of a compressed image along the last axis,
+ * so that consecutive reads hit different tiles.
+ */
+template <typename TImage, typename TReference>
+struct ReadTask
+{
+  const TImage & image;
+  const TReference & reference;
+  std::vector<int> & ok;
+
+  ReadTask( const TImage & anImage, const TReference & aReference, std::vector<int> & anOk )
+    : image( anImage ), reference( aReference ), ok( anOk )
+  {}
+
+  void operator()( std::size_t /*worker*/, std::size_t aTask )
+  {
+    const Z3i::Domain & domain = image.domain();
+    const Z3i::Integer width = domain.upperBound()[ 0 ] - domain.lowerBound()[ 0 ] + 1;
+    Z3i::Point p = domain.lowerBound();
+    p[ 0 ] += (Z3i::Integer) aTask % width;
+    p[ 1 ] += (Z3i::Integer) aTask / width;
+    bool res = true;
+    for ( ; p[ 2 ] <= domain.upperBound()[ 2 ]; ++p[ 2 ] )
+      res = res && ( image( p ) == reference( p ) ) && ( image.compressedSize() > 0 );
+    ok[ aTask ] = res ? 1 : 0;
+  }
+};
+
+/**
+ * Concurrent reads of an image whose codec has no random access: the
+ * reads share the cached tile.
+ */
+template <typename TExecutor>
+bool testConcurrentReads( const TExecutor & anExecutor )
+{
+  trace.beginBlock ( "Testing concurrent reads" );
+  trace.info() << anExecutor << endl;
+
+  typedef ImageContainerByCompressedTiles<Z3i::Domain, int, LZTileCodec<int> > TilesImage;
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> VImage;
+
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 15, 15, 31 ) );
+  TilesImage image( domain, Z3i::Vector( 4, 4, 4 ) );
+  VImage reference( domain );
+  int i = 0;
+  for ( VImage::Iterator it = reference.begin(); it != reference.end(); ++it )
+    *it = ( i++ ) / 5;
+  image.setValues( domain, reference.begin() );
+
+  const std::size_t nbTasks = 16 * 16;
+  std::vector<int> ok( nbTasks, 0 );
+  ReadTask<TilesImage, VImage> task( image, reference, ok );
+  anExecutor.run( nbTasks, task );
+  const bool res = std::count( ok.begin(), ok.end(), 1 ) == (int) nbTasks;
+  trace.info() << "(" << ( res ? 1 : 0 ) << "/1) values read by the tasks" << endl;
+  trace.endBlock();
+
+  return res;
+}
+
+/**
+ * Compression ratios of the codecs on a label volume.
+ */
+template <typename TCodec>
+double compressionRatioOf( const ImageContainerBySTLVector<Z3i::Domain, unsigned char> & anImage )
+{
+  ImageContainerByCompressedTiles<Z3i::Domain, unsigned char, TCodec>
+    image( anImage.domain(), Z3i::Vector( 32, 32, 32 ) );
+  image.setValues( anImage.domain(), anImage.begin() );
+  return image.compressionRatio();
+}
+
+bool testCompressionRatio()
+{
+  trace.beginBlock ( "Compression ratios on a 128^3 label volume" );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> VImage;
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 127, 127, 127 ) );
+  VImage image( domain );
+  const Z3i::Point centers[ 3 ] = { Z3i::Point( 40, 40, 40 ),
+                                    Z3i::Point( 90, 60, 70 ),
+                                    Z3i::Point( 60, 100, 30 ) };
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    for ( unsigned char l = 0; l < 3; ++l )
+      if ( ( *it - centers[ l ] ).norm() < 30 )
+        image.setValue( *it, l + 1 );
+
+  const double rle = compressionRatioOf< RLETileCodec<unsigned char> >( image );
+  const double bits = compressionRatioOf< BitPackingTileCodec<unsigned char> >( image );
+  const double lz = compressionRatioOf< LZTileCodec<unsigned char> >( image );
+  const double adaptive = compressionRatioOf< AdaptiveTileCodec<unsigned char> >( image );
+  trace.info() << "RLE: " << rle << " BitPacking: " << bits
+               << " LZ: " << lz << " Adaptive: " << adaptive << endl;
+  const bool ok = ( rle > 1 ) && ( bits > 1 ) && ( lz > 1 )
+    && ( adaptive >= std::max( rle, std::max( bits, lz ) ) * 0.99 );
+
+  trace.endBlock();
+
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ImageContainerByCompressedTiles" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testCodecs()
+    && testValues< RLETileCodec<int> >( "RLETileCodec" )
+    && testValues< BitPackingTileCodec<int> >( "BitPackingTileCodec" )
+    && testValues< LZTileCodec<int> >( "LZTileCodec" )
+    && testValues< AdaptiveTileCodec<int> >( "AdaptiveTileCodec" )
+    && testTiledImage()
+    && testConcurrentReads( SerialExecutor() )
+    && testConcurrentReads( DefaultExecutor() )
+    && testCompressionRatio();
+#ifdef CPP11_THREAD
+  res = res && testConcurrentReads( ThreadPoolExecutor() );
+#endif
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,242 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByMappedFile.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class ImageContainerByMappedFile.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerByMappedFile.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/images/imagesSetsUtils/SimpleThresholdForegroundPredicate.h"
+#include "DGtal/geometry/volumes/distance/DistanceTransformation.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/io/writers/VolWriter.h"
+#include "DGtal/io/readers/VolReader.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByMappedFile.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef ImageContainerBySTLVector<Z3i::Domain, int> VImage;
+typedef ImageContainerByMappedFile<Z3i::Domain, int> MImage;
+
+/**
+ * Writes the values of an image after a header of @a anOffset bytes.
+ */
+void writeRaw( const std::string & aFilename, const VImage & anImage, std::size_t anOffset )
+{
+  std::ofstream out( aFilename.c_str(), std::ios::out | std::ios::binary );
+  const std::vector<char> header( anOffset, 'h' );
+  out.write( &header[ 0 ], anOffset );
+  out.write( reinterpret_cast<const char*>( &anImage[ 0 ] ), anImage.size() * sizeof( int ) );
+}
+
+/**
+ * Values, modes and copies of a mapped raw file.
+ */
+bool testRaw()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing ImageContainerByMappedFile on a raw file" );
+
+  BOOST_CONCEPT_ASSERT(( CImage<MImage> ));
+
+  const Z3i::Domain domain( Z3i::Point( -3, 2, 1 ), Z3i::Point( 20, 17, 30 ) );
+  VImage reference( domain );
+  int i = 0;
+  for ( VImage::Iterator it = reference.begin(); it != reference.end(); ++it, ++i )
+    *it = ( i * 37 ) % 101;
+  writeRaw( "testImageContainerByMappedFile.raw", reference, 64 );
+
+  {
+    MImage image( "testImageContainerByMappedFile.raw", domain, MImage::ReadOnly, 64,
+                  MImage::Sequential );
+    trace.info() << image << endl;
+    bool ok = image.isValid();
+    for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+      ok = ok && ( image( *it ) == reference( *it ) )
+        && ( image.linearized( *it ) == reference.linearized( *it ) );
+    MImage::ConstRange r = image.constRange();
+    ok = ok && std::equal( r.begin(), r.end(), reference.begin() );
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") ReadOnly values" << endl;
+  }
+
+  {
+    // The modifications are private
+    MImage image( "testImageContainerByMappedFile.raw", domain, MImage::CopyOnWrite, 64 );
+    MImage copy( image );
+    image.setValue( domain.lowerBound(), -1 );
+    std::fill( image.begin(), image.begin() + 10, -2 );
+    const MImage other( "testImageContainerByMappedFile.raw", domain, MImage::ReadOnly, 64 );
+    const bool ok = ( copy( domain.lowerBound() ) == -2 )
+      && ( other( domain.lowerBound() ) == reference( domain.lowerBound() ) )
+      && std::equal( other.begin(), other.end(), reference.begin() );
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") CopyOnWrite" << endl;
+  }
+
+  {
+    // The modifications are written to the file
+    MImage image( "testImageContainerByMappedFile.raw", domain, MImage::ReadWrite, 64 );
+    image.setValue( domain.upperBound(), 12345 );
+    image.flush();
+    MImage other( "testImageContainerByMappedFile.raw", domain, MImage::ReadOnly, 64 );
+    const bool ok = ( other( domain.upperBound() ) == 12345 );
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") ReadWrite" << endl;
+  }
+
+  // Errors
+  bool ok = false;
+  try
+    {
+      MImage image( "testImageContainerByMappedFile.raw",
+                    Z3i::Domain( domain.lowerBound(), domain.upperBound() + Z3i::Point::diagonal( 1 ) ),
+                    MImage::ReadOnly, 64 );
+    }
+  catch ( const IOException & )
+    {
+      ok = true;
+    }
+  try
+    {
+      MImage image( "testImageContainerByMappedFile-missing.raw", domain );
+      ok = false;
+    }
+  catch ( const IOException & )
+    {
+    }
+  try
+    {
+      // The ints would not be aligned
+      MImage image( "testImageContainerByMappedFile.raw", domain, MImage::ReadOnly, 62 );
+      ok = false;
+    }
+  catch ( const IOException & )
+    {
+    }
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") files too small, missing or misaligned" << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Algorithms on a mapped vol file, compared to the loaded image.
+ */
+bool testVol()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing ImageContainerByMappedFile on a vol file" );
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, unsigned char> VolImage;
+  typedef ImageContainerByMappedFile<Z3i::Domain, unsigned char> MappedVolImage;
+
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 31, 23, 15 ) );
+  VolImage image( domain );
+  const Z3i::Point center( 16, 12, 8 );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    image.setValue( *it, ( ( *it - center ).norm() < 7 ) ? 200 : 0 );
+  VolWriter<VolImage>::exportVol( "testImageContainerByMappedFile.vol", image );
+
+  const VolImage loaded = VolReader<VolImage>::importVol( "testImageContainerByMappedFile.vol" );
+  const MappedVolImage mapped( "testImageContainerByMappedFile.vol" );
+  trace.info() << mapped << endl;
+  bool ok = ( mapped.domain().lowerBound() == loaded.domain().lowerBound() )
+    && ( mapped.domain().upperBound() == loaded.domain().upperBound() )
+    && std::equal( mapped.begin(), mapped.end(), loaded.begin() );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") values" << endl;
+
+  std::vector<Z3i::Point> points, expected;
+  setFromImage( mapped, std::back_inserter( points ), 100, 255 );
+  setFromImage( loaded, std::back_inserter( expected ), 100, 255 );
+  nbok += ( ! points.empty() && points == expected ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") setFromImage: " << points.size() << " points" << endl;
+
+  typedef ExactPredicateLpSeparableMetric<Z3i::Space, 2> L2Metric;
+  typedef SimpleThresholdForegroundPredicate<MappedVolImage> MappedPredicate;
+  typedef SimpleThresholdForegroundPredicate<VolImage> Predicate;
+  L2Metric l2;
+  Z3i::Domain dtDomain( domain );
+  MappedPredicate mappedPredicate( mapped, 100 );
+  Predicate predicate( loaded, 100 );
+  DistanceTransformation<Z3i::Space, MappedPredicate, L2Metric> mappedDT( &dtDomain, &mappedPredicate, &l2 );
+  DistanceTransformation<Z3i::Space, Predicate, L2Metric> dt( &dtDomain, &predicate, &l2 );
+  ok = true;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    ok = ok && ( mappedDT( *it ) == dt( *it ) );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") DistanceTransformation" << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ImageContainerByMappedFile" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testRaw() && testVol();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
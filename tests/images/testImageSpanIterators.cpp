@@ -38,6 +38,9 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/base/Executors.h"
+#include "DGtal/base/Clock.h"
 
 using namespace DGtal;
 using namespace std;
@@ -120,11 +123,175 @@ bool testSpanIterators()
 }
 
 
+bool testRowRanges()
+{
+    typedef SpaceND<3> Space3Type;
+    typedef Space3Type::Point Point;
+    typedef HyperRectDomain<Space3Type> TDomain;
+    typedef ImageContainerBySTLVector<TDomain, int> TContainerV;
+
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Test of row ranges");
+    TDomain domain( Point( -2, 1, 0 ), Point( 6, 4, 5 ) );
+    TContainerV image( domain );
+    int cpt = 0;
+    for ( TContainerV::Iterator it = image.begin(); it != image.end(); ++it )
+      *it = cpt++;
+
+    //The rows of a sub-domain, in the order of the domain iterator
+    TDomain subDomain( Point( 0, 2, 1 ), Point( 4, 3, 5 ) );
+    TContainerV::ConstRowRange rows = image.constRowRange( subDomain );
+    bool ok = ( rows.size() == 10 );
+    TDomain::ConstIterator p = subDomain.begin();
+    for ( TContainerV::Size r = 0; r < rows.size(); ++r )
+      {
+        const TContainerV::ConstRowRange::RowSpan row = rows[ r ];
+        ok = ok && ( row.start == *p ) && ( row.length == 5 );
+        for ( TContainerV::Size j = 0; j < row.length; ++j, ++p )
+          ok = ok && ( row.values[ j ] == image( *p ) );
+      }
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") rows of " << subDomain << endl;
+
+    //The chunks split the rows in balanced consecutive parts
+    TContainerV::RowRange allRows = image.rowRange();
+    TContainerV::Size nbRows = 0;
+    ok = true;
+    for ( TContainerV::Size k = 0; k < 7; ++k )
+      {
+        TContainerV::RowRange chunk = allRows.chunk( k, 7 );
+        ok = ok && ( chunk.size() == 3 || chunk.size() == 4 )
+          && ( chunk[ 0 ].start == allRows[ nbRows ].start );
+        nbRows += chunk.size();
+      }
+    ok = ok && ( nbRows == allRows.size() ) && ( nbRows == 24 );
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") chunks" << endl;
+
+    //The iterators visit the rows of operator[]
+    TContainerV::RowRange chunk = allRows.chunk( 2, 7 );
+    ok = ( chunk.end() - chunk.begin() == (std::ptrdiff_t) chunk.size() );
+    TContainerV::Size r = 0;
+    for ( TContainerV::RowRange::ConstIterator it = chunk.begin(), itEnd = chunk.end();
+          it != itEnd; ++it, ++r )
+      {
+        ok = ok && ( it->start == chunk[ r ].start ) && ( it->length == chunk[ r ].length );
+        std::fill( it->values, it->values + it->length, -1 );
+      }
+    ok = ok && ( r == chunk.size() ) && ( ( chunk.begin() + 1 )->start == chunk[ 1 ].start );
+    for ( TContainerV::Size j = 0; j < chunk.size(); ++j )
+      ok = ok && ( image( chunk[ j ].start ) == -1 );
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") row iterators" << endl;
+
+    trace.endBlock();
+    return nbok == nb;
+}
+
+/**
+ * Point functor for the helpers.
+ */
+struct PointValue
+{
+    typedef SpaceND<3>::Point Point;
+    typedef int Value;
+    Value operator()( const Point & p ) const
+    {
+      return ( p[ 0 ] * 7 + p[ 1 ] * 3 + p[ 2 ] ) % 11;
+    }
+};
+
+template <typename TExecutor>
+bool testHelpers( const TExecutor & anExecutor )
+{
+    typedef SpaceND<3> Space3Type;
+    typedef Space3Type::Point Point;
+    typedef HyperRectDomain<Space3Type> TDomain;
+    typedef ImageContainerBySTLVector<TDomain, int> TContainerV;
+
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Test of the image helpers on rows");
+    trace.info() << anExecutor << endl;
+    TDomain domain( Point( -10, 0, 3 ), Point( 117, 127, 130 ) );
+    TContainerV reference( domain );
+    TContainerV image( domain );
+    PointValue f;
+    Clock c;
+
+    //Point by point
+    c.startClock();
+    std::transform( domain.begin(), domain.end(), reference.range().outputIterator(), f );
+    const double tPoints = c.stopClock();
+
+    c.startClock();
+    imageFromFunctor( image, f, anExecutor );
+    const double tRows = c.stopClock();
+    nbok += std::equal( image.begin(), image.end(), reference.begin() ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") imageFromFunctor: "
+                 << tPoints << " ms by points, " << tRows << " ms by rows" << endl;
+
+    TContainerV copy( domain );
+    c.startClock();
+    imageFromImage( copy, image, anExecutor );
+    const double tCopy = c.stopClock();
+    nbok += std::equal( copy.begin(), copy.end(), reference.begin() ) ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") imageFromImage: "
+                 << tCopy << " ms" << endl;
+
+    //Sub-domain filled from a larger image
+    TContainerV small( TDomain( Point( 0, 10, 20 ), Point( 50, 60, 70 ) ) );
+    imageFromConstImage( small, image, anExecutor );
+    bool ok = true;
+    for ( TDomain::ConstIterator it = small.domain().begin(), itEnd = small.domain().end();
+          it != itEnd; ++it )
+      ok = ok && ( small( *it ) == f( *it ) );
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") imageFromConstImage" << endl;
+
+    //Thresholded sets, compared to the point predicates
+    std::vector<Point> points, expected;
+    setFromImage( small, std::back_inserter( points ), 3 );
+    for ( TDomain::ConstIterator it = small.domain().begin(), itEnd = small.domain().end();
+          it != itEnd; ++it )
+      if ( small( *it ) <= 3 )
+        expected.push_back( *it );
+    ok = ( points == expected );
+    points.clear();
+    expected.clear();
+    setFromImage( small, std::back_inserter( points ), 2, 5 );
+    for ( TDomain::ConstIterator it = small.domain().begin(), itEnd = small.domain().end();
+          it != itEnd; ++it )
+      if ( small( *it ) >= 2 && small( *it ) <= 5 )
+        expected.push_back( *it );
+    ok = ok && ( points == expected );
+    nbok += ok ? 1 : 0;
+    nb++;
+    trace.info() << "(" << nbok << "/" << nb << ") setFromImage" << endl;
+
+    trace.endBlock();
+    return nbok == nb;
+}
+
 
 int main()
 {
 
-    if ( testSpanIterators())
+    bool res = testSpanIterators() && testRowRanges()
+      && testHelpers( SerialExecutor() ) && testHelpers( DefaultExecutor() );
+#ifdef CPP11_THREAD
+    res = res && testHelpers( ThreadPoolExecutor() );
+#endif
+    if ( res )
         return 0;
     else
         return 1;
@@ -29,6 +29,8 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <cstdlib>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/images/Morton.h"
@@ -120,6 +122,103 @@ bool testMorton()
   return nbok == nb;
 }
 
+/**
+ * Interleaves the coordinates bit per bit (reference code).
+ */
+template <typename HashKey, typename Point>
+HashKey referenceInterleave( const Point & aPoint )
+{
+  const unsigned int coordBits = sizeof( HashKey ) * 8 / Point::dimension;
+  HashKey result = 0;
+  for ( unsigned int i = 0; i < coordBits; ++i )
+    for ( unsigned int n = 0; n < Point::dimension; ++n )
+      if ( ( static_cast<HashKey>( aPoint[n] ) >> i ) & 1 )
+        result |= static_cast<HashKey>( 1 ) << ( i * Point::dimension + n );
+  return result;
+}
+
+/**
+ * Compares the interleaving of random points to the reference code,
+ * and checks the batch encoding/decoding roundtrip.
+ */
+template <typename HashKey, typename Point>
+bool testInterleave( const std::string & aName )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing Morton codes against the reference code (" + aName + ")" );
+
+  const unsigned int coordBits = sizeof( HashKey ) * 8 / Point::dimension;
+  const std::size_t n = 1000;
+  std::vector<Point> points( n ), decoded( n );
+  std::vector<HashKey> keys( n );
+  for ( std::size_t k = 0; k < n; ++k )
+    for ( unsigned int d = 0; d < Point::dimension; ++d )
+      {
+        DGtal::uint64_t c = ( static_cast<DGtal::uint64_t>( rand() ) << 32 ) ^ rand();
+        // keep the coordinates in the range of the codes (and of the
+        // point coordinates)
+        if ( coordBits < 31 )
+          c &= ( static_cast<DGtal::uint64_t>( 1 ) << coordBits ) - 1;
+        else
+          c &= 0x7FFFFFFF;
+        points[k][d] = static_cast<typename Point::Coordinate>( c );
+      }
+
+  Morton<HashKey,Point> morton;
+  bool ok = true;
+  for ( std::size_t k = 0; k < n; ++k )
+    {
+      HashKey h;
+      morton.interleaveBits( points[k], h );
+      ok = ok && ( h == referenceInterleave<HashKey>( points[k] ) );
+    }
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") interleaveBits" << endl;
+
+  morton.encode( &points[0], &keys[0], n );
+  morton.decode( &keys[0], &decoded[0], n );
+  ok = true;
+  for ( std::size_t k = 0; k < n; ++k )
+    ok = ok && ( keys[k] == referenceInterleave<HashKey>( points[k] ) )
+      && ( decoded[k] == points[k] );
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") encode/decode" << endl;
+
+  // Keys with the depth prefix (which needs one more bit)
+  const std::size_t depth = coordBits <= 8 ? coordBits - 1 : 8;
+  ok = true;
+  for ( std::size_t k = 0; k < n; ++k )
+    {
+      Point p = points[k], q;
+      for ( unsigned int d = 0; d < Point::dimension; ++d )
+        p[d] &= ( 1 << depth ) - 1;
+      morton.coordinatesFromKey( morton.keyFromCoordinates( depth, p ), q );
+      ok = ok && ( p == q );
+    }
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") keyFromCoordinates/coordinatesFromKey" << endl;
+
+  trace.beginBlock( "Batch encoding benchmark" );
+  HashKey sum = 0;
+  for ( unsigned int k = 0; k < 1000; ++k )
+    {
+      morton.encode( &points[0], &keys[0], n );
+      sum += keys[k];
+    }
+  trace.endBlock();
+  if ( sum == 345 )
+    trace.info() << "Compiler trick" << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -131,7 +230,15 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testMorton(); // && ... other tests
+  bool res = testMorton()
+    && testInterleave<DGtal::uint16_t, PointVector<2,DGtal::int32_t> >( "2D, 16 bits" )
+    && testInterleave<DGtal::uint32_t, PointVector<2,DGtal::int32_t> >( "2D, 32 bits" )
+    && testInterleave<DGtal::uint64_t, PointVector<2,DGtal::int32_t> >( "2D, 64 bits" )
+    && testInterleave<DGtal::uint16_t, PointVector<3,DGtal::int32_t> >( "3D, 16 bits" )
+    && testInterleave<DGtal::uint32_t, PointVector<3,DGtal::int32_t> >( "3D, 32 bits" )
+    && testInterleave<DGtal::uint64_t, PointVector<3,DGtal::int64_t> >( "3D, 64 bits" )
+    && testInterleave<DGtal::uint32_t, PointVector<4,DGtal::int32_t> >( "4D, 32 bits" )
+    && testInterleave<DGtal::uint64_t, PointVector<4,DGtal::int32_t> >( "4D, 64 bits" );
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
@@ -177,6 +177,141 @@ bool test3d()
     return nbok == nb;
 }
 
+bool testWriteBack()
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing write-back TiledImageFromImage");
+    
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+    VImage image(Z2i::Domain(Z2i::Point(-3,2), Z2i::Point(7,11)));
+    
+    int i = 1;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+    
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+    
+    typedef ImageCacheReadPolicyFIFO<OutputImage, MyImageFactoryFromImage> MyImageCacheReadPolicyFIFO;
+    typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWB;
+    MyImageCacheReadPolicyFIFO imageCacheReadPolicyFIFO(imageFactoryFromImage, 2);
+    MyImageCacheWritePolicyWB imageCacheWritePolicyWB(imageFactoryFromImage);
+    
+    typedef TiledImageFromImage<VImage, MyImageFactoryFromImage, MyImageCacheReadPolicyFIFO, MyImageCacheWritePolicyWB> MyTiledImageFromImage;
+    MyTiledImageFromImage tiledImageFromImage(image, imageFactoryFromImage, imageCacheReadPolicyFIFO, imageCacheWritePolicyWB, 3);
+    
+    // 11x10 domain, 3 tiles of 4 values per dimension (the last ones cropped)
+    Z2i::Domain tile = tiledImageFromImage.findSubDomain(Z2i::Point(7,2));
+    trace.info() << "Tile of Point 7,2: " << tile << endl;
+    nbok += ((tile.lowerBound() == Z2i::Point(5,2)) && (tile.upperBound() == Z2i::Point(7,5))) ? 1 : 0;
+    nb++;
+    
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+    
+    nbok += (tiledImageFromImage(Z2i::Point(-3,3)) == 12) ? 1 : 0;
+    nb++;
+    
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+    
+    tiledImageFromImage.setValue(Z2i::Point(7,11), -1);
+    trace.info() << "Write value for Point 7,11, ORIGINAL image value: " << image(Z2i::Point(7,11)) << endl;
+    nbok += (image(Z2i::Point(7,11)) == 110) ? 1 : 0;
+    nb++;
+    
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+    
+    tiledImageFromImage.flush();
+    trace.info() << "After flush, ORIGINAL image value: " << image(Z2i::Point(7,11)) << endl;
+    nbok += (image(Z2i::Point(7,11)) == -1) ? 1 : 0;
+    nb++;
+    
+    trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+    
+    trace.endBlock();
+    
+    return nbok == nb;
+}
+
+template <typename TReadPolicy>
+bool testReadPolicy(const std::string & aName, const unsigned int aNbMisses)
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+
+    trace.beginBlock("Testing TiledImageFromImage with the read policy " + aName);
+    
+    typedef ImageContainerBySTLVector<Z2i::Domain, int> VImage;
+    Z2i::Domain domain(Z2i::Point(-3,2), Z2i::Point(7,11));
+    VImage image(domain);
+    VImage reference(domain);
+    
+    int i = 1;
+    for (VImage::Iterator it = image.begin(); it != image.end(); ++it)
+        *it = i++;
+    std::copy(image.begin(), image.end(), reference.begin());
+    
+    typedef ImageFactoryFromImage<VImage> MyImageFactoryFromImage;
+    typedef typename MyImageFactoryFromImage::OutputImage OutputImage;
+    MyImageFactoryFromImage imageFactoryFromImage(image);
+    
+    typedef ImageCacheWritePolicyWB<OutputImage, MyImageFactoryFromImage> MyImageCacheWritePolicyWB;
+    TReadPolicy imageCacheReadPolicy(imageFactoryFromImage, domain, 3, 2);
+    MyImageCacheWritePolicyWB imageCacheWritePolicyWB(imageFactoryFromImage);
+    
+    typedef TiledImageFromImage<VImage, MyImageFactoryFromImage, TReadPolicy, MyImageCacheWritePolicyWB> MyTiledImageFromImage;
+    {
+      MyTiledImageFromImage tiledImageFromImage(image, imageFactoryFromImage, imageCacheReadPolicy, imageCacheWritePolicyWB, 3);
+      
+      // Tiles A, B, A, C, A (cache of 2 tiles): LRU keeps A when C
+      // arrives, FIFO and CLOCK evict it.
+      tiledImageFromImage(Z2i::Point(-3,2));
+      tiledImageFromImage(Z2i::Point(1,2));
+      tiledImageFromImage(Z2i::Point(-2,3));
+      tiledImageFromImage(Z2i::Point(5,2));
+      tiledImageFromImage(Z2i::Point(-1,4));
+      trace.info() << tiledImageFromImage.imageCache() << endl;
+      nbok += ( (tiledImageFromImage.imageCache().nbMisses() == aNbMisses) &&
+                (tiledImageFromImage.imageCache().nbHits() == 5 - aNbMisses) &&
+                (tiledImageFromImage.imageCache().nbEvictions() == aNbMisses - 2) ) ? 1 : 0;
+      nb++;
+      
+      trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+      
+      // Random reads and writes compared with the reference image
+      bool ok = true;
+      for (unsigned int j = 0; j < 2000; ++j)
+      {
+        const Z2i::Point p(-3 + rand() % 11, 2 + rand() % 10);
+        if (rand() % 2)
+        {
+          tiledImageFromImage.setValue(p, j);
+          reference.setValue(p, j);
+        }
+        else
+          ok = ok && (tiledImageFromImage(p) == reference(p));
+      }
+      nbok += ok ? 1 : 0;
+      nb++;
+      
+      trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+    }
+    
+    // The destruction of the tiled image flushes the cache
+    nbok += std::equal(image.begin(), image.end(), reference.begin()) ? 1 : 0;
+    nb++;
+    
+    trace.info() << "(" << nbok << "/" << nb << ") "
+                 << "flushed pages=" << imageCacheWritePolicyWB.nbFlushedPages()
+                 << " bytes=" << imageCacheWritePolicyWB.nbFlushedBytes() << endl;
+    
+    trace.endBlock();
+    
+    return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -188,7 +323,11 @@ int main( int argc, char** argv )
         trace.info() << " " << argv[ i ];
     trace.info() << endl;
 
-    bool res = testSimple() && test3d(); // && ... other tests
+    typedef ImageFactoryFromImage<ImageContainerBySTLVector<Z2i::Domain, int> > MyImageFactoryFromImage;
+    typedef MyImageFactoryFromImage::OutputImage OutputImage;
+    bool res = testSimple() && test3d() && testWriteBack()
+      && testReadPolicy<ImageCacheReadPolicyLRU<OutputImage, MyImageFactoryFromImage> >("LRU", 3)
+      && testReadPolicy<ImageCacheReadPolicyCLOCK<OutputImage, MyImageFactoryFromImage> >("CLOCK", 4); // && ... other tests
 
     trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
     trace.endBlock();
@@ -50,6 +50,8 @@
 #include "DGtal/kernel/domains/CDomainArchetype.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 #include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
+#include "DGtal/kernel/sets/DigitalSetByRuns.h"
 #include "DGtal/kernel/sets/DigitalSetFromMap.h"
 #include "DGtal/kernel/sets/DigitalSetSelector.h"
 #include "DGtal/kernel/sets/DigitalSetDomain.h"
@@ -404,6 +406,16 @@ int main()
     ( DigitalSetBySTLSet<Domain>(domain), DigitalSetBySTLSet<Domain>(domain) );
   trace.endBlock();
 
+  trace.beginBlock( "DigitalSetByBitVector" );
+  bool okBitVector = testDigitalSet< DigitalSetByBitVector<Domain> >
+    ( DigitalSetByBitVector<Domain>(domain), DigitalSetByBitVector<Domain>(domain) );
+  trace.endBlock();
+
+  trace.beginBlock( "DigitalSetByRuns" );
+  bool okRuns = testDigitalSet< DigitalSetByRuns<Domain> >
+    ( DigitalSetByRuns<Domain>(domain), DigitalSetByRuns<Domain>(domain) );
+  trace.endBlock();
+
   trace.beginBlock( "DigitalSetFromMap" );
   typedef ImageContainerBySTLMap<Domain,short int> Map; 
   Map map(domain); Map map2(domain);        //maps
@@ -430,7 +442,7 @@ int main()
 
   bool okDigitalSetDrawSnippet = testDigitalSetBoardSnippet();
 
-  bool res = okVector && okSet && okMap 
+  bool res = okVector && okSet && okBitVector && okRuns && okMap 
       && okSelectorSmall && okSelectorBig && okSelectorMediumHBel
       && okDigitalSetDomain && okDigitalSetDraw && okDigitalSetDrawSnippet;
   trace.endBlock();
@@ -0,0 +1,363 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSetByBitVector.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class DigitalSetByBitVector.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/sets/DigitalSetByBitVector.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/kernel/sets/DigitalSetInserter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalSetByBitVector.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef DigitalSetByBitVector<Z3i::Domain> BitSet;
+
+/**
+ * @return the points of @a aDomain in @a aSet, in the domain order.
+ */
+std::vector<Z3i::Point> inDomainOrder( const Z3i::Domain & aDomain,
+                                       const std::set<Z3i::Point> & aSet )
+{
+  std::vector<Z3i::Point> res;
+  for ( Z3i::Domain::ConstIterator it = aDomain.begin(), itEnd = aDomain.end(); it != itEnd; ++it )
+    if ( aSet.count( *it ) )
+      res.push_back( *it );
+  return res;
+}
+
+/**
+ * Random points of a domain.
+ */
+std::set<Z3i::Point> randomPoints( const Z3i::Domain & aDomain, unsigned int n )
+{
+  std::set<Z3i::Point> res;
+  const Z3i::Point extent = aDomain.upperBound() - aDomain.lowerBound() + Z3i::Point::diagonal( 1 );
+  for ( unsigned int i = 0; i < n; ++i )
+    res.insert( aDomain.lowerBound() + Z3i::Point( rand() % extent[ 0 ],
+                                                   rand() % extent[ 1 ],
+                                                   rand() % extent[ 2 ] ) );
+  return res;
+}
+
+/**
+ * Insertion, erasure, search and iteration compared to a std::set.
+ */
+bool testBasics()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing DigitalSetByBitVector services" );
+  BOOST_CONCEPT_ASSERT(( CDigitalSet< BitSet > ));
+
+  // 455 points: the last word is not full
+  const Z3i::Domain domain( Z3i::Point( -3, 2, 1 ), Z3i::Point( 9, 8, 5 ) );
+  BitSet set( domain );
+  nbok += ( set.empty() && set.begin() == set.end() && set.isValid() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") empty set: " << set << endl;
+
+  std::set<Z3i::Point> reference = randomPoints( domain, 200 );
+  set.insert( reference.begin(), reference.end() );
+  set.insert( *reference.begin() );
+  set.insertNew( domain.upperBound() );
+  reference.insert( domain.upperBound() );
+  std::vector<Z3i::Point> expected = inDomainOrder( domain, reference );
+  std::vector<Z3i::Point> points( set.begin(), set.end() );
+  nbok += ( set.size() == reference.size() && points == expected && set.isValid() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") insertion and iteration: " << set << endl;
+
+  std::vector<Z3i::Point> backward;
+  for ( BitSet::ConstIterator it = set.end(); it != set.begin(); )
+    backward.push_back( *--it );
+  std::reverse( backward.begin(), backward.end() );
+  nbok += ( backward == expected ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") backward iteration" << endl;
+
+  bool ok = ( set.find( Z3i::Point( 100, 0, 0 ) ) == set.end() )
+    && ! set( Z3i::Point( 100, 0, 0 ) );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    {
+      const bool in = reference.count( *it ) != 0;
+      ok = ok && ( set( *it ) == in )
+        && ( in ? ( *set.find( *it ) == *it ) : ( set.find( *it ) == set.end() ) );
+    }
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") find and belonging" << endl;
+
+  // Erase every other point through the iterators, which remain valid
+  unsigned int i = 0;
+  for ( BitSet::Iterator it = set.begin(); it != set.end(); ++it, ++i )
+    if ( i % 2 == 0 )
+      {
+        reference.erase( *it );
+        set.erase( it );
+      }
+  const Z3i::Point p = *reference.begin();
+  nbok += ( set.erase( p ) == 1 && set.erase( p ) == 0 ) ? 1 : 0;
+  nb++;
+  reference.erase( p );
+  points.assign( set.begin(), set.end() );
+  nbok += ( set.size() == reference.size() && points == inDomainOrder( domain, reference )
+            && set.isValid() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") erasure: " << set << endl;
+
+  Z3i::Point lower, upper;
+  set.computeBoundingBox( lower, upper );
+  Z3i::Point eLower = *reference.begin(), eUpper = *reference.begin();
+  for ( std::set<Z3i::Point>::const_iterator it = reference.begin(); it != reference.end(); ++it )
+    {
+      eLower = eLower.inf( *it );
+      eUpper = eUpper.sup( *it );
+    }
+  nbok += ( lower == eLower && upper == eUpper ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") bounding box " << lower << " " << upper << endl;
+
+  BitSet copy( set );
+  set.erase( set.begin(), set.end() );
+  nbok += ( set.empty() && copy.size() == reference.size() ) ? 1 : 0;
+  nb++;
+  set = copy;
+  copy.clear();
+  nbok += ( set.size() == reference.size() && copy.empty() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") copy, erase range and clear" << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Complement, union, intersection and difference compared to the STL
+ * algorithms, on the same domain and on different domains.
+ */
+bool testSetOperations()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing DigitalSetByBitVector set operations" );
+
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 20, 10, 6 ) );
+  const Z3i::Domain sub( Z3i::Point( 2, 1, 1 ), Z3i::Point( 15, 9, 5 ) );
+  const std::set<Z3i::Point> a = randomPoints( domain, 600 );
+  const std::set<Z3i::Point> b = randomPoints( domain, 600 );
+  const std::set<Z3i::Point> c = randomPoints( sub, 200 );
+  BitSet setA( domain ), setB( domain ), setC( sub );
+  setA.insert( a.begin(), a.end() );
+  setB.insert( b.begin(), b.end() );
+  setC.insert( c.begin(), c.end() );
+
+  // Complement
+  std::set<Z3i::Point> all( domain.begin(), domain.end() );
+  std::set<Z3i::Point> complementA;
+  std::set_difference( all.begin(), all.end(), a.begin(), a.end(),
+                       std::inserter( complementA, complementA.begin() ) );
+  std::vector<Z3i::Point> points;
+  std::back_insert_iterator< std::vector<Z3i::Point> > ito( points );
+  setA.computeComplement( ito );
+  nbok += ( points == inDomainOrder( domain, complementA ) ) ? 1 : 0;
+  nb++;
+  BitSet complement( domain );
+  complement.assignFromComplement( setA );
+  points.assign( complement.begin(), complement.end() );
+  nbok += ( points == inDomainOrder( domain, complementA ) && complement.isValid() ) ? 1 : 0;
+  nb++;
+  BitSet inserted( domain );
+  DigitalSetInserter<BitSet> inserter( inserted );
+  setA.computeComplement( inserter );
+  nbok += ( inserted.size() == domain.size() - a.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") complement" << endl;
+
+  // Complement of a set of another domain
+  complement.assignFromComplement( setC );
+  std::set<Z3i::Point> complementC;
+  std::set_difference( all.begin(), all.end(), c.begin(), c.end(),
+                       std::inserter( complementC, complementC.begin() ) );
+  points.assign( complement.begin(), complement.end() );
+  nbok += ( points == inDomainOrder( domain, complementC ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") complement of a set of a sub-domain" << endl;
+
+  // Word operations and point by point operations
+  std::set<Z3i::Point> expected;
+  std::set_union( a.begin(), a.end(), b.begin(), b.end(),
+                  std::inserter( expected, expected.begin() ) );
+  BitSet result( setA );
+  result += setB;
+  points.assign( result.begin(), result.end() );
+  nbok += ( points == inDomainOrder( domain, expected ) && result.isValid() ) ? 1 : 0;
+  nb++;
+
+  expected.clear();
+  std::set_intersection( a.begin(), a.end(), b.begin(), b.end(),
+                         std::inserter( expected, expected.begin() ) );
+  result = setA;
+  result *= setB;
+  points.assign( result.begin(), result.end() );
+  nbok += ( points == inDomainOrder( domain, expected ) && result.isValid() ) ? 1 : 0;
+  nb++;
+
+  expected.clear();
+  std::set_difference( a.begin(), a.end(), b.begin(), b.end(),
+                       std::inserter( expected, expected.begin() ) );
+  result = setA;
+  result -= setB;
+  points.assign( result.begin(), result.end() );
+  nbok += ( points == inDomainOrder( domain, expected ) && result.isValid() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") union, intersection, difference" << endl;
+
+  expected.clear();
+  std::set_union( a.begin(), a.end(), c.begin(), c.end(),
+                  std::inserter( expected, expected.begin() ) );
+  result = setA;
+  result += setC;
+  points.assign( result.begin(), result.end() );
+  nbok += ( points == inDomainOrder( domain, expected ) ) ? 1 : 0;
+  nb++;
+
+  expected.clear();
+  std::set_intersection( a.begin(), a.end(), c.begin(), c.end(),
+                         std::inserter( expected, expected.begin() ) );
+  result = setA;
+  result *= setC;
+  points.assign( result.begin(), result.end() );
+  nbok += ( points == inDomainOrder( domain, expected ) ) ? 1 : 0;
+  nb++;
+
+  expected.clear();
+  std::set_difference( a.begin(), a.end(), c.begin(), c.end(),
+                       std::inserter( expected, expected.begin() ) );
+  result = setA;
+  result -= setC;
+  points.assign( result.begin(), result.end() );
+  nbok += ( points == inDomainOrder( domain, expected ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") operations with a set of a sub-domain" << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Sets chosen by DigitalSetSelector.
+ */
+bool testSelector()
+{
+  trace.beginBlock ( "Testing DigitalSetSelector" );
+  bool ok = boost::is_same< DigitalSetSelector< Z3i::Domain, BIG_DS + HIGH_VAR_DS >::Type,
+                            BitSet >::value
+    && boost::is_same< DigitalSetSelector< Z3i::Domain, WHOLE_DS + HIGH_VAR_DS + HIGH_ITER_DS + HIGH_BEL_DS >::Type,
+                       BitSet >::value
+    && boost::is_same< DigitalSetSelector< Z3i::Domain, BIG_DS + HIGH_BEL_DS >::Type,
+                       DigitalSetBySTLSet<Z3i::Domain> >::value
+    && boost::is_same< DigitalSetSelector< Z3i::Domain, MEDIUM_DS + HIGH_VAR_DS >::Type,
+                       DigitalSetBySTLSet<Z3i::Domain> >::value
+    && boost::is_same< DigitalSetSelector< Z3i::Domain, SMALL_DS >::Type,
+                       DigitalSetBySTLVector<Z3i::Domain> >::value;
+  trace.info() << ( ok ? "ok" : "failed" ) << endl;
+  trace.endBlock();
+  return ok;
+}
+
+/**
+ * A big dense set: a ball in a 128^3 domain.
+ */
+bool testBigSet()
+{
+  trace.beginBlock ( "Ball of radius 60 in a 128^3 domain" );
+
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 127, 127, 127 ) );
+  const Z3i::Point center( 64, 64, 64 );
+  BitSet set( domain );
+  trace.beginBlock ( "Insertion" );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    if ( ( *it - center ).norm() < 60 )
+      set.insertNew( *it );
+  trace.endBlock();
+
+  trace.beginBlock ( "Iteration" );
+  Z3i::Point sum;
+  BitSet::Size n = 0;
+  for ( BitSet::ConstIterator it = set.begin(), itEnd = set.end(); it != itEnd; ++it, ++n )
+    sum += *it;
+  trace.endBlock();
+
+  trace.beginBlock ( "Complement" );
+  BitSet complement( domain );
+  complement.assignFromComplement( set );
+  trace.endBlock();
+
+  trace.info() << set << " " << complement << endl;
+  const bool ok = ( n == set.size() ) && ( set.size() + complement.size() == domain.size() )
+    && ( sum == center * (Z3i::Point::Coordinate) n );
+
+  trace.endBlock();
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class DigitalSetByBitVector" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testBasics() && testSetOperations() && testSelector() && testBigSet();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,342 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSetByHashSet.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class DigitalSetByHashSet.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <vector>
+#include <list>
+#include <algorithm>
+#include <iterator>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/sets/DigitalSetByHashSet.h"
+#include "DGtal/kernel/sets/DigitalSetSelector.h"
+#include "DGtal/kernel/sets/DigitalSetInserter.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalSetByHashSet.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef DigitalSetByHashSet<Z3i::Domain> HashSet;
+
+/**
+ * Order of the points in a domain: the last coordinate first.
+ */
+struct DomainOrder
+{
+  bool operator()( const Z3i::Point & a, const Z3i::Point & b ) const
+  {
+    return std::lexicographical_compare( a.rbegin(), a.rend(), b.rbegin(), b.rend() );
+  }
+};
+
+/**
+ * @return the points of @a aSet, in the domain order.
+ */
+std::vector<Z3i::Point> inDomainOrder( const std::set<Z3i::Point> & aSet )
+{
+  std::vector<Z3i::Point> res( aSet.begin(), aSet.end() );
+  std::sort( res.begin(), res.end(), DomainOrder() );
+  return res;
+}
+
+/**
+ * Random points of a domain.
+ */
+std::set<Z3i::Point> randomPoints( const Z3i::Domain & aDomain, unsigned int n )
+{
+  std::set<Z3i::Point> res;
+  const Z3i::Point extent = aDomain.upperBound() - aDomain.lowerBound() + Z3i::Point::diagonal( 1 );
+  for ( unsigned int i = 0; i < n; ++i )
+    res.insert( aDomain.lowerBound() + Z3i::Point( rand() % extent[ 0 ],
+                                                   rand() % extent[ 1 ],
+                                                   rand() % extent[ 2 ] ) );
+  return res;
+}
+
+/**
+ * Insertion, erasure, search and iteration compared to a std::set.
+ */
+bool testBasics()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing DigitalSetByHashSet services" );
+  BOOST_CONCEPT_ASSERT(( CDigitalSet< HashSet > ));
+
+  const Z3i::Domain domain( Z3i::Point( -3, 2, 1 ), Z3i::Point( 9, 8, 5 ) );
+  HashSet set( domain );
+  nbok += ( set.empty() && set.begin() == set.end() && set.isValid() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") empty set: " << set << endl;
+
+  // Single insertions, then a bulk insertion from an input range
+  std::set<Z3i::Point> reference = randomPoints( domain, 200 );
+  std::set<Z3i::Point>::const_iterator itRef = reference.begin();
+  for ( unsigned int i = 0; i < 50; ++i, ++itRef )
+    set.insert( *itRef );
+  std::list<Z3i::Point> others( itRef, reference.end() );
+  set.insert( others.begin(), others.end() );
+  set.insert( *reference.begin() );
+  set.insertNew( domain.upperBound() );
+  reference.insert( domain.upperBound() );
+  std::vector<Z3i::Point> points( set.begin(), set.end() );
+  std::sort( points.begin(), points.end() );
+  nbok += ( set.size() == reference.size() && set.isValid()
+            && std::equal( points.begin(), points.end(), reference.begin() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") insertion and iteration: " << set << endl;
+
+  std::vector<Z3i::Point> sorted;
+  set.exportSorted( std::back_inserter( sorted ) );
+  nbok += ( sorted == inDomainOrder( reference ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") sorted export" << endl;
+
+  std::vector<Z3i::Point> backward;
+  for ( HashSet::ConstIterator it = set.end(); it != set.begin(); )
+    backward.push_back( *--it );
+  std::reverse( backward.begin(), backward.end() );
+  nbok += ( backward == std::vector<Z3i::Point>( set.begin(), set.end() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") backward iteration" << endl;
+
+  bool ok = ( set.find( Z3i::Point( 100, 0, 0 ) ) == set.end() )
+    && ! set( Z3i::Point( 100, 0, 0 ) );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    {
+      const bool in = reference.count( *it ) != 0;
+      ok = ok && ( set( *it ) == in )
+        && ( in ? ( *set.find( *it ) == *it ) : ( set.find( *it ) == set.end() ) );
+    }
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") find and belonging" << endl;
+
+  // Erase every other point through the iterators, which remain valid
+  unsigned int i = 0;
+  for ( HashSet::Iterator it = set.begin(); it != set.end(); ++it, ++i )
+    if ( i % 2 == 0 )
+      {
+        reference.erase( *it );
+        set.erase( it );
+      }
+  const Z3i::Point p = *reference.begin();
+  nbok += ( set.erase( p ) == 1 && set.erase( p ) == 0 ) ? 1 : 0;
+  nb++;
+  reference.erase( p );
+  points.assign( set.begin(), set.end() );
+  std::sort( points.begin(), points.end() );
+  nbok += ( set.size() == reference.size() && set.isValid()
+            && std::equal( points.begin(), points.end(), reference.begin() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") erasure: " << set << endl;
+
+  // Many insertions and erasures: the erased slots are reused or purged
+  for ( unsigned int j = 0; j < 20; ++j )
+    {
+      const std::set<Z3i::Point> some = randomPoints( domain, 100 );
+      set.insert( some.begin(), some.end() );
+      for ( std::set<Z3i::Point>::const_iterator it = some.begin(); it != some.end(); ++it )
+        if ( reference.count( *it ) == 0 )
+          set.erase( *it );
+    }
+  nbok += ( set.size() == reference.size() && set.isValid() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") insertions and erasures: " << set << endl;
+
+  Z3i::Point lower, upper;
+  set.computeBoundingBox( lower, upper );
+  Z3i::Point eLower = *reference.begin(), eUpper = *reference.begin();
+  for ( std::set<Z3i::Point>::const_iterator it = reference.begin(); it != reference.end(); ++it )
+    {
+      eLower = eLower.inf( *it );
+      eUpper = eUpper.sup( *it );
+    }
+  nbok += ( lower == eLower && upper == eUpper ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") bounding box " << lower << " " << upper << endl;
+
+  HashSet copy( set );
+  set.erase( set.begin(), set.end() );
+  nbok += ( set.empty() && copy.size() == reference.size() ) ? 1 : 0;
+  nb++;
+  set = copy;
+  copy.clear();
+  nbok += ( set.size() == reference.size() && copy.empty() && set.isValid() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") copy, erase range and clear" << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Complement and union compared to the STL algorithms.
+ */
+bool testSetOperations()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing DigitalSetByHashSet set operations" );
+
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 20, 10, 6 ) );
+  const Z3i::Domain sub( Z3i::Point( 2, 1, 1 ), Z3i::Point( 15, 9, 5 ) );
+  const std::set<Z3i::Point> a = randomPoints( domain, 600 );
+  const std::set<Z3i::Point> c = randomPoints( sub, 200 );
+  HashSet setA( domain ), setC( sub );
+  setA.insert( a.begin(), a.end() );
+  setC.insert( c.begin(), c.end() );
+
+  std::set<Z3i::Point> all( domain.begin(), domain.end() );
+  std::set<Z3i::Point> complementA;
+  std::set_difference( all.begin(), all.end(), a.begin(), a.end(),
+                       std::inserter( complementA, complementA.begin() ) );
+  std::vector<Z3i::Point> points;
+  std::back_insert_iterator< std::vector<Z3i::Point> > ito( points );
+  setA.computeComplement( ito );
+  nbok += ( points == inDomainOrder( complementA ) ) ? 1 : 0;
+  nb++;
+  HashSet complement( domain );
+  complement.assignFromComplement( setA );
+  points.clear();
+  complement.exportSorted( std::back_inserter( points ) );
+  nbok += ( points == inDomainOrder( complementA ) && complement.isValid() ) ? 1 : 0;
+  nb++;
+  HashSet inserted( domain );
+  DigitalSetInserter<HashSet> inserter( inserted );
+  setA.computeComplement( inserter );
+  nbok += ( inserted.size() == domain.size() - a.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") complement" << endl;
+
+  std::set<Z3i::Point> expected;
+  std::set_union( a.begin(), a.end(), c.begin(), c.end(),
+                  std::inserter( expected, expected.begin() ) );
+  HashSet result( setA );
+  result += setC;
+  points.clear();
+  result.exportSorted( std::back_inserter( points ) );
+  nbok += ( points == inDomainOrder( expected ) && result.isValid() ) ? 1 : 0;
+  nb++;
+  result = setC;
+  nbok += ( result.size() == c.size() && result.isValid() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") union and assignment from a sub-domain" << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Sets chosen by DigitalSetSelector.
+ */
+bool testSelector()
+{
+  trace.beginBlock ( "Testing DigitalSetSelector" );
+  bool ok = boost::is_same< DigitalSetSelector< Z3i::Domain, SMALL_DS + HUGE_DOMAIN_DS >::Type,
+                            HashSet >::value
+    && boost::is_same< DigitalSetSelector< Z3i::Domain, MEDIUM_DS + HIGH_VAR_DS + HIGH_BEL_DS + HUGE_DOMAIN_DS >::Type,
+                       HashSet >::value
+    && boost::is_same< DigitalSetSelector< Z3i::Domain, BIG_DS + HIGH_VAR_DS >::Type,
+                       DigitalSetByBitVector<Z3i::Domain> >::value
+    && boost::is_same< DigitalSetSelector< Z3i::Domain, MEDIUM_DS + HIGH_VAR_DS >::Type,
+                       DigitalSetBySTLSet<Z3i::Domain> >::value;
+  trace.info() << ( ok ? "ok" : "failed" ) << endl;
+  trace.endBlock();
+  return ok;
+}
+
+/**
+ * Scattered points in a domain of 10^12 points.
+ */
+bool testHugeDomain()
+{
+  trace.beginBlock ( "100000 points in a 10000^3 domain" );
+
+  const Z3i::Domain domain( Z3i::Point( -5000, -5000, -5000 ), Z3i::Point( 4999, 4999, 4999 ) );
+  std::vector<Z3i::Point> points;
+  for ( unsigned int i = 0; i < 100000; ++i )
+    points.push_back( domain.lowerBound() + Z3i::Point( rand() % 10000,
+                                                        rand() % 10000,
+                                                        rand() % 10000 ) );
+  const std::set<Z3i::Point> reference( points.begin(), points.end() );
+
+  HashSet set( domain );
+  trace.beginBlock ( "Insertion" );
+  set.insert( points.begin(), points.end() );
+  trace.endBlock();
+
+  trace.beginBlock ( "Belonging test" );
+  bool ok = true;
+  for ( std::vector<Z3i::Point>::const_iterator it = points.begin(); it != points.end(); ++it )
+    {
+      const Z3i::Point q = *it + Z3i::Point( 0, 0, 1 );
+      ok = ok && set( *it ) && ( set( q ) == ( reference.count( q ) != 0 ) );
+    }
+  trace.endBlock();
+
+  std::vector<Z3i::Point> sorted;
+  set.exportSorted( std::back_inserter( sorted ) );
+  trace.info() << set << endl;
+  ok = ok && ( set.size() == reference.size() ) && set.isValid()
+    && ( sorted == inDomainOrder( reference ) );
+
+  trace.endBlock();
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class DigitalSetByHashSet" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testBasics() && testSetOperations() && testSelector() && testHugeDomain();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,432 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSetByRuns.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class DigitalSetByRuns.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/sets/DigitalSetByRuns.h"
+#include "DGtal/kernel/sets/DigitalSetConverter.h"
+#include "DGtal/kernel/sets/DigitalSetInserter.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/imagesSetsUtils/SetFromImage.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalSetByRuns.
+///////////////////////////////////////////////////////////////////////////////
+
+typedef DigitalSetByRuns<Z3i::Domain> RunSet;
+
+/**
+ * @return the points of @a aDomain in @a aSet, in the domain order.
+ */
+std::vector<Z3i::Point> inDomainOrder( const Z3i::Domain & aDomain,
+                                       const std::set<Z3i::Point> & aSet )
+{
+  std::vector<Z3i::Point> res;
+  for ( Z3i::Domain::ConstIterator it = aDomain.begin(), itEnd = aDomain.end(); it != itEnd; ++it )
+    if ( aSet.count( *it ) )
+      res.push_back( *it );
+  return res;
+}
+
+/**
+ * Random points of a domain.
+ */
+std::set<Z3i::Point> randomPoints( const Z3i::Domain & aDomain, unsigned int n )
+{
+  std::set<Z3i::Point> res;
+  const Z3i::Point extent = aDomain.upperBound() - aDomain.lowerBound() + Z3i::Point::diagonal( 1 );
+  for ( unsigned int i = 0; i < n; ++i )
+    res.insert( aDomain.lowerBound() + Z3i::Point( rand() % extent[ 0 ],
+                                                   rand() % extent[ 1 ],
+                                                   rand() % extent[ 2 ] ) );
+  return res;
+}
+
+/**
+ * Insertion, erasure, search and iteration compared to a std::set.
+ */
+bool testBasics()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing DigitalSetByRuns services" );
+  BOOST_CONCEPT_ASSERT(( CDigitalSet< RunSet > ));
+
+  const Z3i::Domain domain( Z3i::Point( -3, 2, 1 ), Z3i::Point( 9, 8, 5 ) );
+  RunSet set( domain );
+  nbok += ( set.empty() && set.begin() == set.end() && set.isValid() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") empty set: " << set << endl;
+
+  // Single insertions in random order, then a bulk insertion
+  std::set<Z3i::Point> reference = randomPoints( domain, 200 );
+  std::vector<Z3i::Point> shuffled( reference.begin(), reference.end() );
+  std::random_shuffle( shuffled.begin(), shuffled.end() );
+  set.insert( shuffled.begin() + 100, shuffled.end() );
+  for ( unsigned int i = 0; i < 100; ++i )
+    set.insert( shuffled[ i ] );
+  set.insert( shuffled[ 0 ] );
+  set.insertNew( domain.upperBound() );
+  reference.insert( domain.upperBound() );
+  std::vector<Z3i::Point> expected = inDomainOrder( domain, reference );
+  std::vector<Z3i::Point> points( set.begin(), set.end() );
+  nbok += ( set.size() == reference.size() && points == expected && set.isValid() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") insertion and iteration: " << set << endl;
+
+  std::vector<Z3i::Point> backward;
+  for ( RunSet::ConstIterator it = set.end(); it != set.begin(); )
+    backward.push_back( *--it );
+  std::reverse( backward.begin(), backward.end() );
+  nbok += ( backward == expected ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") backward iteration" << endl;
+
+  bool ok = ( set.find( Z3i::Point( 100, 0, 0 ) ) == set.end() )
+    && ! set( Z3i::Point( 100, 0, 0 ) );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    {
+      const bool in = reference.count( *it ) != 0;
+      ok = ok && ( set( *it ) == in )
+        && ( in ? ( *set.find( *it ) == *it ) : ( set.find( *it ) == set.end() ) );
+    }
+  nbok += ok ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") find and belonging" << endl;
+
+  // Erase every other point, splitting the runs
+  for ( unsigned int i = 0; i < expected.size(); i += 2 )
+    {
+      reference.erase( expected[ i ] );
+      set.erase( set.find( expected[ i ] ) );
+    }
+  const Z3i::Point p = *reference.begin();
+  nbok += ( set.erase( p ) == 1 && set.erase( p ) == 0 ) ? 1 : 0;
+  nb++;
+  reference.erase( p );
+  points.assign( set.begin(), set.end() );
+  nbok += ( set.size() == reference.size() && points == inDomainOrder( domain, reference )
+            && set.isValid() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") erasure: " << set << endl;
+
+  Z3i::Point lower, upper;
+  set.computeBoundingBox( lower, upper );
+  Z3i::Point eLower = *reference.begin(), eUpper = *reference.begin();
+  for ( std::set<Z3i::Point>::const_iterator it = reference.begin(); it != reference.end(); ++it )
+    {
+      eLower = eLower.inf( *it );
+      eUpper = eUpper.sup( *it );
+    }
+  nbok += ( lower == eLower && upper == eUpper ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") bounding box " << lower << " " << upper << endl;
+
+  RunSet copy( set );
+  RunSet::Iterator itBegin = set.begin(), itEnd = set.begin();
+  for ( unsigned int i = 0; i < 10; ++i )
+    ++itEnd;
+  std::vector<Z3i::Point> rest( itEnd, set.end() );
+  set.erase( itBegin, itEnd );
+  points.assign( set.begin(), set.end() );
+  nbok += ( points == rest && set.isValid() ) ? 1 : 0;
+  nb++;
+  set.erase( set.begin(), set.end() );
+  nbok += ( set.empty() && copy.size() == reference.size() ) ? 1 : 0;
+  nb++;
+  set = copy;
+  copy.clear();
+  nbok += ( set.size() == reference.size() && copy.empty() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") copy, erase range and clear" << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Complement, union, intersection and difference compared to the STL
+ * algorithms, on the same domain and on different domains.
+ */
+bool testSetOperations()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing DigitalSetByRuns set operations" );
+
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 20, 10, 6 ) );
+  const Z3i::Domain sub( Z3i::Point( 2, 1, 1 ), Z3i::Point( 15, 9, 5 ) );
+  const std::set<Z3i::Point> a = randomPoints( domain, 600 );
+  const std::set<Z3i::Point> b = randomPoints( domain, 600 );
+  const std::set<Z3i::Point> c = randomPoints( sub, 200 );
+  RunSet setA( domain ), setB( domain ), setC( sub );
+  setA.insert( a.begin(), a.end() );
+  setB.insert( b.begin(), b.end() );
+  setC.insert( c.begin(), c.end() );
+
+  // Complement
+  std::set<Z3i::Point> all( domain.begin(), domain.end() );
+  std::set<Z3i::Point> complementA;
+  std::set_difference( all.begin(), all.end(), a.begin(), a.end(),
+                       std::inserter( complementA, complementA.begin() ) );
+  std::vector<Z3i::Point> points;
+  std::back_insert_iterator< std::vector<Z3i::Point> > ito( points );
+  setA.computeComplement( ito );
+  nbok += ( points == inDomainOrder( domain, complementA ) ) ? 1 : 0;
+  nb++;
+  RunSet complement( domain );
+  complement.assignFromComplement( setA );
+  points.assign( complement.begin(), complement.end() );
+  nbok += ( points == inDomainOrder( domain, complementA ) && complement.isValid() ) ? 1 : 0;
+  nb++;
+  RunSet inserted( domain );
+  DigitalSetInserter<RunSet> inserter( inserted );
+  setA.computeComplement( inserter );
+  nbok += ( inserted.size() == domain.size() - a.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") complement" << endl;
+
+  // Complement of a set of another domain
+  complement.assignFromComplement( setC );
+  std::set<Z3i::Point> complementC;
+  std::set_difference( all.begin(), all.end(), c.begin(), c.end(),
+                       std::inserter( complementC, complementC.begin() ) );
+  points.assign( complement.begin(), complement.end() );
+  nbok += ( points == inDomainOrder( domain, complementC ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") complement of a set of a sub-domain" << endl;
+
+  std::set<Z3i::Point> expected;
+  std::set_union( a.begin(), a.end(), b.begin(), b.end(),
+                  std::inserter( expected, expected.begin() ) );
+  RunSet result( setA );
+  result += setB;
+  points.assign( result.begin(), result.end() );
+  nbok += ( points == inDomainOrder( domain, expected ) && result.isValid() ) ? 1 : 0;
+  nb++;
+
+  expected.clear();
+  std::set_intersection( a.begin(), a.end(), b.begin(), b.end(),
+                         std::inserter( expected, expected.begin() ) );
+  result = setA;
+  result *= setB;
+  points.assign( result.begin(), result.end() );
+  nbok += ( points == inDomainOrder( domain, expected ) && result.isValid() ) ? 1 : 0;
+  nb++;
+
+  expected.clear();
+  std::set_difference( a.begin(), a.end(), b.begin(), b.end(),
+                       std::inserter( expected, expected.begin() ) );
+  result = setA;
+  result -= setB;
+  points.assign( result.begin(), result.end() );
+  nbok += ( points == inDomainOrder( domain, expected ) && result.isValid() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") union, intersection, difference" << endl;
+
+  expected.clear();
+  std::set_union( a.begin(), a.end(), c.begin(), c.end(),
+                  std::inserter( expected, expected.begin() ) );
+  result = setA;
+  result += setC;
+  points.assign( result.begin(), result.end() );
+  nbok += ( points == inDomainOrder( domain, expected ) && result.isValid() ) ? 1 : 0;
+  nb++;
+
+  expected.clear();
+  std::set_intersection( a.begin(), a.end(), c.begin(), c.end(),
+                         std::inserter( expected, expected.begin() ) );
+  result = setA;
+  result *= setC;
+  points.assign( result.begin(), result.end() );
+  nbok += ( points == inDomainOrder( domain, expected ) && result.isValid() ) ? 1 : 0;
+  nb++;
+
+  expected.clear();
+  std::set_difference( a.begin(), a.end(), c.begin(), c.end(),
+                       std::inserter( expected, expected.begin() ) );
+  result = setA;
+  result -= setC;
+  points.assign( result.begin(), result.end() );
+  nbok += ( points == inDomainOrder( domain, expected ) && result.isValid() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") operations with a set of a sub-domain" << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Dilation and erosion compared to their definitions.
+ */
+bool testMorphology()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing DigitalSetByRuns dilation and erosion" );
+
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 15, 12, 9 ) );
+  const std::set<Z3i::Point> a = randomPoints( domain, 2500 );
+  RunSet set( domain );
+  set.insert( a.begin(), a.end() );
+
+  // 6-neighborhood and a non symmetric element
+  std::vector<Z3i::Vector> elements[ 2 ];
+  elements[ 0 ].push_back( Z3i::Vector( 0, 0, 0 ) );
+  for ( Dimension k = 0; k < 3; ++k )
+    {
+      elements[ 0 ].push_back( Z3i::Vector::base( k, 1 ) );
+      elements[ 0 ].push_back( Z3i::Vector::base( k, -1 ) );
+    }
+  elements[ 1 ].push_back( Z3i::Vector( 2, 0, 0 ) );
+  elements[ 1 ].push_back( Z3i::Vector( 3, 0, 0 ) );
+  elements[ 1 ].push_back( Z3i::Vector( 1, -1, 0 ) );
+  elements[ 1 ].push_back( Z3i::Vector( 0, 1, 2 ) );
+
+  for ( unsigned int e = 0; e < 2; ++e )
+    {
+      const std::vector<Z3i::Vector> & element = elements[ e ];
+      std::set<Z3i::Point> dilated, eroded;
+      for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+        {
+          bool all = true;
+          for ( unsigned int i = 0; i < element.size(); ++i )
+            {
+              all = all && ( a.count( *it + element[ i ] ) != 0 );
+              if ( a.count( *it - element[ i ] ) != 0 )
+                dilated.insert( *it );
+            }
+          if ( all )
+            eroded.insert( *it );
+        }
+
+      RunSet result( set );
+      result.dilate( element.begin(), element.end() );
+      std::vector<Z3i::Point> points( result.begin(), result.end() );
+      nbok += ( points == inDomainOrder( domain, dilated ) && result.isValid() ) ? 1 : 0;
+      nb++;
+
+      result = set;
+      result.erode( element.begin(), element.end() );
+      points.assign( result.begin(), result.end() );
+      nbok += ( points == inDomainOrder( domain, eroded ) && result.isValid() ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") structuring element " << e
+                   << ": dilated " << dilated.size() << " eroded " << eroded.size() << endl;
+    }
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Streaming construction from Shapes and SetFromImage, and
+ * conversions from and to other digital sets.
+ */
+bool testConstructions()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing DigitalSetByRuns constructions and conversions" );
+
+  const Z3i::Domain domain( Z3i::Point( -25, -25, -25 ), Z3i::Point( 25, 25, 25 ) );
+  const ImplicitBall<Z3i::Space> ball( Z3i::RealPoint( 0.5, 0.0, -1.0 ), 20.0 );
+  RunSet set( domain );
+  Z3i::DigitalSet reference( domain );
+  Shapes<Z3i::Domain>::euclideanShaper( set, ball );
+  Shapes<Z3i::Domain>::euclideanShaper( reference, ball );
+  nbok += ( set.size() == reference.size() && set.isValid()
+            && std::equal( reference.begin(), reference.end(),
+                           std::set<Z3i::Point>( set.begin(), set.end() ).begin() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") ball: " << set << endl;
+
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+  Image image( domain );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    image.setValue( *it, reference( *it ) ? 200 : 0 );
+  RunSet fromImage( domain );
+  SetFromImage<RunSet>::append<Image>( fromImage, image, 0, 255 );
+  nbok += ( fromImage.runs().size() == set.runs().size() && fromImage.size() == set.size()
+            && fromImage.isValid() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") from image: " << fromImage << endl;
+
+  Z3i::DigitalSet converted( domain );
+  DigitalSetConverter<Z3i::DigitalSet>::assign( converted, set );
+  RunSet back( domain );
+  DigitalSetConverter<RunSet>::assign( back, converted );
+  nbok += ( converted.size() == set.size() && back.runs().size() == set.runs().size()
+            && std::equal( set.begin(), set.end(), back.begin() ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") conversions" << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class DigitalSetByRuns" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testBasics() && testSetOperations() && testMorphology() && testConstructions();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
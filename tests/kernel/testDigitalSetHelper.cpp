@@ -0,0 +1,311 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSetHelper.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing the functions of DigitalSetHelper and the
+ * bulk operations of DigitalSetBySTLVector and DigitalSetBySTLSet.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Executors.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/sets/DigitalSetHelper.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLSet.h"
+#include "DGtal/kernel/sets/DigitalSetDomain.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing DigitalSetHelper.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Serial executor announcing three workers, so that the domains are
+ * cut into slabs even without OpenMP.
+ */
+struct ThreeWorkersExecutor : public SerialExecutor
+{
+  Size nbWorkers() const
+  {
+    return 3;
+  }
+};
+
+/**
+ * Random points of a domain.
+ */
+std::set<Z3i::Point> randomPoints( const Z3i::Domain & aDomain, unsigned int n )
+{
+  std::set<Z3i::Point> res;
+  const Z3i::Point extent = aDomain.upperBound() - aDomain.lowerBound() + Z3i::Point::diagonal( 1 );
+  for ( unsigned int i = 0; i < n; ++i )
+    res.insert( aDomain.lowerBound() + Z3i::Point( rand() % extent[ 0 ],
+                                                   rand() % extent[ 1 ],
+                                                   rand() % extent[ 2 ] ) );
+  return res;
+}
+
+/**
+ * @return the points of @a aDomain which are not in @a aSet, in the
+ * domain order.
+ */
+std::vector<Z3i::Point> complementByScan( const Z3i::Domain & aDomain,
+                                          const std::set<Z3i::Point> & aSet )
+{
+  std::vector<Z3i::Point> res;
+  for ( Z3i::Domain::ConstIterator it = aDomain.begin(), itEnd = aDomain.end(); it != itEnd; ++it )
+    if ( ! aSet.count( *it ) )
+      res.push_back( *it );
+  return res;
+}
+
+/**
+ * complementInDomain with a single and several slabs, compared to
+ * a scan of the domain.
+ */
+bool testComplementInDomain()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing complementInDomain" );
+
+  // 6 and 13 slices: exact and uneven cuts into slabs.
+  const Z3i::Domain domains[ 2 ] = {
+    Z3i::Domain( Z3i::Point( -3, 2, 1 ), Z3i::Point( 9, 8, 6 ) ),
+    Z3i::Domain( Z3i::Point( 0, 0, -6 ), Z3i::Point( 4, 7, 6 ) ) };
+  for ( unsigned int d = 0; d < 2; ++d )
+    {
+      const Z3i::Domain & domain = domains[ d ];
+      std::set<Z3i::Point> reference = randomPoints( domain, 150 );
+      std::vector<Z3i::Point> expected = complementByScan( domain, reference );
+
+      // points outside the domain are ignored
+      std::vector<Z3i::Point> points( reference.begin(), reference.end() );
+      points.push_back( domain.upperBound() + Z3i::Point( 1, 0, 0 ) );
+      points.push_back( domain.lowerBound() - Z3i::Point( 0, 1, 0 ) );
+      points.push_back( domain.lowerBound() - Z3i::Point( 0, 0, 1 ) );
+      std::sort( points.begin(), points.end(), detail::DomainOrder() );
+
+      std::vector<Z3i::Point> serial;
+      std::back_insert_iterator< std::vector<Z3i::Point> > itSerial( serial );
+      complementInDomain( domain, points.begin(), points.end(), itSerial, SerialExecutor() );
+      nbok += ( serial == expected ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") serial, "
+                   << expected.size() << " points" << endl;
+
+      std::vector<Z3i::Point> sliced;
+      std::back_insert_iterator< std::vector<Z3i::Point> > itSliced( sliced );
+      complementInDomain( domain, points.begin(), points.end(), itSliced, ThreeWorkersExecutor() );
+      nbok += ( sliced == expected ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") slabs" << endl;
+
+      std::vector<Z3i::Point> omp;
+      std::back_insert_iterator< std::vector<Z3i::Point> > itOmp( omp );
+      complementInDomain( domain, points.begin(), points.end(), itOmp, OpenMPExecutor() );
+      nbok += ( omp == expected ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") " << OpenMPExecutor() << endl;
+    }
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Bulk insertion, set operations and complement of a digital set,
+ * compared to std::set.
+ */
+template <typename TDigitalSet>
+bool testBulkOperations( const std::string & aName )
+{
+  typedef TDigitalSet DigitalSet;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing bulk operations of " + aName );
+  BOOST_CONCEPT_ASSERT(( CDigitalSet< DigitalSet > ));
+
+  const Z3i::Domain domain( Z3i::Point( -3, 2, 1 ), Z3i::Point( 9, 8, 12 ) );
+  std::set<Z3i::Point> a = randomPoints( domain, 500 );
+  std::set<Z3i::Point> b = randomPoints( domain, 500 );
+
+  // Bulk insertions with duplicates and points already in the set
+  DigitalSet setA( domain );
+  std::vector<Z3i::Point> shuffled( a.begin(), a.end() );
+  std::random_shuffle( shuffled.begin(), shuffled.end() );
+  setA.insert( shuffled.begin(), shuffled.begin() + 300 );
+  setA.insert( shuffled.begin() + 200, shuffled.end() );
+  setA.insert( shuffled.begin(), shuffled.begin() + 5 );
+  setA.insert( shuffled.begin(), shuffled.end() );
+  std::set<Z3i::Point> points( setA.begin(), setA.end() );
+  nbok += ( setA.size() == a.size() && points == a ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") bulk insertion: " << setA << endl;
+
+  DigitalSet setB( domain );
+  setB.insert( b.begin(), b.end() );
+  std::set<Z3i::Point> expected;
+
+  DigitalSet inter( setA );
+  inter *= setB;
+  std::set_intersection( a.begin(), a.end(), b.begin(), b.end(),
+                         std::inserter( expected, expected.end() ) );
+  points = std::set<Z3i::Point>( inter.begin(), inter.end() );
+  nbok += ( inter.size() == expected.size() && points == expected ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") intersection: " << inter << endl;
+
+  DigitalSet diff( setA );
+  diff -= setB;
+  expected.clear();
+  std::set_difference( a.begin(), a.end(), b.begin(), b.end(),
+                       std::inserter( expected, expected.end() ) );
+  points = std::set<Z3i::Point>( diff.begin(), diff.end() );
+  nbok += ( diff.size() == expected.size() && points == expected ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") difference: " << diff << endl;
+
+  DigitalSet self( setA );
+  self *= self;
+  nbok += ( self.size() == setA.size() ) ? 1 : 0;
+  self -= self;
+  nbok += self.empty() ? 1 : 0;
+  nb += 2;
+  trace.info() << "(" << nbok << "/" << nb << ") operations with itself" << endl;
+
+  // Complement
+  std::vector<Z3i::Point> complement = complementByScan( domain, a );
+  std::vector<Z3i::Point> serial;
+  std::back_insert_iterator< std::vector<Z3i::Point> > itSerial( serial );
+  setA.computeComplement( itSerial );
+  nbok += ( serial == complement ) ? 1 : 0;
+  nb++;
+  std::vector<Z3i::Point> sliced;
+  std::back_insert_iterator< std::vector<Z3i::Point> > itSliced( sliced );
+  setA.computeComplement( itSliced, ThreeWorkersExecutor() );
+  nbok += ( sliced == complement ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") complement" << endl;
+
+  DigitalSet other( domain );
+  other.assignFromComplement( setA );
+  points = std::set<Z3i::Point>( other.begin(), other.end() );
+  nbok += ( other.size() == complement.size()
+            && points == std::set<Z3i::Point>( complement.begin(), complement.end() ) ) ? 1 : 0;
+  nb++;
+  other.assignFromComplement( other );
+  points = std::set<Z3i::Point>( other.begin(), other.end() );
+  nbok += ( other.size() == a.size() && points == a ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") assignment from complement" << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Complement in a domain which is not a HyperRectDomain.
+ */
+bool testComplementInDigitalSetDomain()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing complement in a DigitalSetDomain" );
+
+  typedef DigitalSetBySTLSet<Z3i::Domain> SupportSet;
+  typedef DigitalSetDomain<SupportSet> Domain;
+  const Z3i::Domain box( Z3i::Point( 0, 0, 0 ), Z3i::Point( 7, 7, 7 ) );
+  std::set<Z3i::Point> supportPoints = randomPoints( box, 200 );
+  SupportSet support( box );
+  support.insert( supportPoints.begin(), supportPoints.end() );
+  const Domain domain( support );
+
+  std::vector<Z3i::Point> shuffled( supportPoints.begin(), supportPoints.end() );
+  std::random_shuffle( shuffled.begin(), shuffled.end() );
+  std::set<Z3i::Point> half( shuffled.begin(), shuffled.begin() + shuffled.size() / 2 );
+
+  DigitalSetBySTLVector<Domain> vectorSet( domain );
+  vectorSet.insert( half.begin(), half.end() );
+  std::vector<Z3i::Point> complement;
+  std::back_insert_iterator< std::vector<Z3i::Point> > ito( complement );
+  vectorSet.computeComplement( ito );
+  std::set<Z3i::Point> expected;
+  std::set_difference( supportPoints.begin(), supportPoints.end(), half.begin(), half.end(),
+                       std::inserter( expected, expected.end() ) );
+  nbok += ( std::set<Z3i::Point>( complement.begin(), complement.end() ) == expected
+            && complement.size() == expected.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") DigitalSetBySTLVector" << endl;
+
+  DigitalSetBySTLSet<Domain> setSet( domain );
+  setSet.insert( half.begin(), half.end() );
+  DigitalSetBySTLSet<Domain> setComplement( domain );
+  setComplement.assignFromComplement( setSet );
+  nbok += ( std::set<Z3i::Point>( setComplement.begin(), setComplement.end() ) == expected ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") DigitalSetBySTLSet" << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing DigitalSetHelper and the bulk operations of digital sets" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testComplementInDomain()
+    && testBulkOperations< DigitalSetBySTLVector<Z3i::Domain> >( "DigitalSetBySTLVector" )
+    && testBulkOperations< DigitalSetBySTLSet<Z3i::Domain> >( "DigitalSetBySTLSet" )
+    && testComplementInDigitalSetDomain();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
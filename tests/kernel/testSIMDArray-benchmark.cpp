@@ -0,0 +1,181 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSIMDArray-benchmark.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Benchmarks of the points with boost::array and SIMDArray
+ * containers: domain scanning, neighbourhoods and point arithmetic.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Clock.h"
+#include "DGtal/kernel/SIMDArray.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/topology/MetricAdjacency.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for benchmarking the SIMDArray points.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Scans a domain of @a aSize^3 points @a nbScans times and sums the
+ * points.
+ */
+template <typename TSpace>
+void benchmarkScan( const std::string & aName,
+                    typename TSpace::Integer aSize, unsigned int nbScans )
+{
+  typedef typename TSpace::Point Point;
+  typedef HyperRectDomain<TSpace> Domain;
+
+  const Domain domain( Point::diagonal( 0 ), Point::diagonal( aSize - 1 ) );
+  Point sum;
+  Clock c;
+  c.startClock();
+  for ( unsigned int k = 0; k < nbScans; ++k )
+    for ( typename Domain::ConstIterator it = domain.begin(), itEnd = domain.end();
+          it != itEnd; ++it )
+      sum += *it;
+  const double t = c.stopClock();
+  const double nbPoints = (double) domain.size() * nbScans;
+  trace.info() << aName << " domain scan: " << nbPoints / t / 1000.0
+               << " Mpoints/s (" << t << " ms, checksum " << sum << ")" << endl;
+}
+
+/**
+ * Generates the neighbours of random points with MetricAdjacency.
+ */
+template <typename TSpace, Dimension maxNorm1>
+void benchmarkNeighbours( const std::string & aName, unsigned int nbPoints )
+{
+  typedef typename TSpace::Point Point;
+  typedef MetricAdjacency<TSpace, maxNorm1> Adjacency;
+
+  std::vector<Point> points( nbPoints );
+  srand( 0 );
+  for ( unsigned int i = 0; i < nbPoints; ++i )
+    points[ i ] = Point( rand() % 1000, rand() % 1000, rand() % 1000 );
+  std::vector<Point> neighbours;
+  neighbours.reserve( 32 );
+  Point sum;
+  Clock c;
+  c.startClock();
+  for ( unsigned int i = 0; i < nbPoints; ++i )
+    {
+      neighbours.clear();
+      std::back_insert_iterator< std::vector<Point> > out( neighbours );
+      Adjacency::writeNeighbors( out, points[ i ] );
+      sum += neighbours.back();
+    }
+  const double t = c.stopClock();
+  trace.info() << aName << " neighbours (n1<=" << maxNorm1 << "): "
+               << nbPoints / t / 1000.0 << " Mpoints/s (" << t
+               << " ms, checksum " << sum << ")" << endl;
+}
+
+/**
+ * Bounding box (inf/sup) and lexicographic sort of random points.
+ */
+template <typename TSpace>
+void benchmarkArithmetic( const std::string & aName, unsigned int nbPoints )
+{
+  typedef typename TSpace::Point Point;
+
+  std::vector<Point> points( nbPoints );
+  srand( 0 );
+  for ( unsigned int i = 0; i < nbPoints; ++i )
+    points[ i ] = Point( rand() % 64, rand() % 64, rand() % 64 );
+  Clock c;
+  c.startClock();
+  Point lower = points[ 0 ];
+  Point upper = points[ 0 ];
+  for ( unsigned int k = 0; k < 20; ++k )
+    for ( unsigned int i = 0; i < nbPoints; ++i )
+      {
+        lower = lower.inf( points[ i ] - Point::diagonal( k ) );
+        upper = upper.sup( points[ i ] + Point::diagonal( k ) );
+      }
+  const double tBox = c.stopClock();
+  c.startClock();
+  std::sort( points.begin(), points.end() );
+  const double tSort = c.stopClock();
+  trace.info() << aName << " inf/sup: " << 20.0 * nbPoints / tBox / 1000.0
+               << " Mpoints/s, sort: " << tSort << " ms (checksum "
+               << lower << upper << ")" << endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  typedef SpaceND<3, DGtal::int32_t> Space;
+  typedef SpaceND<3, DGtal::int32_t, SIMDArray<DGtal::int32_t, 3> > SIMDSpace;
+  typedef SpaceND<3, DGtal::int64_t> Space64;
+  typedef SpaceND<3, DGtal::int64_t, SIMDArray<DGtal::int64_t, 3> > SIMDSpace64;
+
+  trace.beginBlock ( "Benchmarking boost::array and SIMDArray points" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  trace.beginBlock( "HyperRectDomain scan" );
+  benchmarkScan<Space>( "boost::array int32", 256, 4 );
+  benchmarkScan<SIMDSpace>( "SIMDArray    int32", 256, 4 );
+  benchmarkScan<Space64>( "boost::array int64", 256, 4 );
+  benchmarkScan<SIMDSpace64>( "SIMDArray    int64", 256, 4 );
+  trace.endBlock();
+
+  trace.beginBlock( "MetricAdjacency neighbours" );
+  benchmarkNeighbours<Space, 1>( "boost::array int32", 1000000 );
+  benchmarkNeighbours<SIMDSpace, 1>( "SIMDArray    int32", 1000000 );
+  benchmarkNeighbours<Space, 3>( "boost::array int32", 1000000 );
+  benchmarkNeighbours<SIMDSpace, 3>( "SIMDArray    int32", 1000000 );
+  benchmarkNeighbours<Space64, 3>( "boost::array int64", 1000000 );
+  benchmarkNeighbours<SIMDSpace64, 3>( "SIMDArray    int64", 1000000 );
+  trace.endBlock();
+
+  trace.beginBlock( "Point arithmetic" );
+  benchmarkArithmetic<Space>( "boost::array int32", 1000000 );
+  benchmarkArithmetic<SIMDSpace>( "SIMDArray    int32", 1000000 );
+  benchmarkArithmetic<Space64>( "boost::array int64", 1000000 );
+  benchmarkArithmetic<SIMDSpace64>( "SIMDArray    int64", 1000000 );
+  trace.endBlock();
+
+  trace.endBlock();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,228 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testSIMDArray.cpp
+ * @ingroup Tests
+ * @author agent (\c agent@local )
+ *
+ * @date 2026/10/17
+ *
+ * Functions for testing class SIMDArray.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <set>
+#include <vector>
+#include <iterator>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/SIMDArray.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/kernel/SpaceND.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/topology/MetricAdjacency.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class SIMDArray.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @return a random point with coordinates in [-3,3], so that equal
+ * components are frequent.
+ */
+template <typename TPoint>
+TPoint randomPoint()
+{
+  TPoint p;
+  for ( typename TPoint::Dimension i = 0; i < TPoint::dimension; ++i )
+    p[ i ] = (typename TPoint::Component) ( rand() % 7 - 3 );
+  return p;
+}
+
+/**
+ * @return 'true' if the SIMD point @a p has the coordinates of @a q.
+ */
+template <typename TSIMDPoint, typename TPoint>
+bool same( const TSIMDPoint & p, const TPoint & q )
+{
+  return std::equal( p.begin(), p.end(), q.begin() );
+}
+
+/**
+ * Operators of PointVector on SIMDArray compared to the ones on
+ * boost::array, for random points.
+ */
+template <typename T, Dimension N>
+bool testOperations( const std::string & aName )
+{
+  typedef PointVector<N, T> Point;
+  typedef PointVector<N, T, SIMDArray<T, N> > SIMDPoint;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing SIMDArray operators, " + aName );
+  trace.info() << "sizeof(SIMDPoint)=" << sizeof( SIMDPoint ) << endl;
+
+  nbok += ( SIMDPoint::dimension == N && SIMDPoint().size() == N
+            && sizeof( SIMDPoint ) == sizeof( Point ) ) ? 1 : 0;
+  nb++;
+
+  unsigned int nbArithmetic = 0;
+  unsigned int nbComparisons = 0;
+  const unsigned int nbTrials = 2000;
+  for ( unsigned int k = 0; k < nbTrials; ++k )
+    {
+      const Point a = randomPoint<Point>();
+      const Point b = randomPoint<Point>();
+      const SIMDPoint sa( a );
+      const SIMDPoint sb( b );
+
+      SIMDPoint sc( sa );
+      sc += sb;
+      SIMDPoint sd( sa );
+      sd -= sb;
+      SIMDPoint se( sa );
+      se.negate();
+      nbArithmetic += ( same( sa + sb, a + b ) && same( sa - sb, a - b )
+                        && same( -sa, -a ) && same( sc, a + b )
+                        && same( sd, a - b ) && same( se, -a )
+                        && same( sa.inf( sb ), a.inf( b ) )
+                        && same( sa.sup( sb ), a.sup( b ) )
+                        && sa.dot( sb ) == a.dot( b ) ) ? 1 : 0;
+      nbComparisons += ( ( sa == sb ) == ( a == b ) && ( sa != sb ) == ( a != b )
+                         && ( sa < sb ) == ( a < b ) && ( sa <= sb ) == ( a <= b )
+                         && ( sa > sb ) == ( a > b ) && ( sa >= sb ) == ( a >= b )
+                         && sa.isLower( sb ) == a.isLower( b )
+                         && sa.isUpper( sb ) == a.isUpper( b ) ) ? 1 : 0;
+    }
+  nbok += ( nbArithmetic == nbTrials ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") +, -, inf, sup, dot: "
+               << nbArithmetic << "/" << nbTrials << endl;
+  nbok += ( nbComparisons == nbTrials ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") comparisons: "
+               << nbComparisons << "/" << nbTrials << endl;
+
+  // Whole point operations after component writes.
+  SIMDPoint p = SIMDPoint::diagonal( 5 );
+  p[ 0 ] = -2;
+  p -= SIMDPoint::diagonal( 5 );
+  p += SIMDPoint::base( N - 1, 3 );
+  Point q = Point::diagonal( 5 );
+  q[ 0 ] = -2;
+  q -= Point::diagonal( 5 );
+  q += Point::base( N - 1, 3 );
+  nbok += ( same( p, q ) && p == SIMDPoint( q ) && !( p < SIMDPoint( q ) )
+            && p.norm1() == q.norm1() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << p << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+/**
+ * Domain scanning, adjacencies and ordered sets in a space with
+ * SIMDArray points, compared to the default space.
+ */
+bool testSpace()
+{
+  typedef SpaceND<3, DGtal::int32_t> Space;
+  typedef SpaceND<3, DGtal::int32_t, SIMDArray<DGtal::int32_t, 3> > SIMDSpace;
+  typedef HyperRectDomain<Space> Domain;
+  typedef HyperRectDomain<SIMDSpace> SIMDDomain;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing a SpaceND with SIMDArray points" );
+
+  const Domain domain( Space::Point( -2, 0, 1 ), Space::Point( 3, 4, 5 ) );
+  const SIMDDomain simdDomain( SIMDSpace::Point( -2, 0, 1 ), SIMDSpace::Point( 3, 4, 5 ) );
+  std::vector<Space::Point> points( domain.begin(), domain.end() );
+  std::vector<SIMDSpace::Point> simdPoints( simdDomain.begin(), simdDomain.end() );
+  bool sameScan = points.size() == simdPoints.size() && simdDomain.size() == domain.size();
+  for ( std::size_t i = 0; sameScan && i < points.size(); ++i )
+    sameScan = same( simdPoints[ i ], points[ i ] );
+  nbok += sameScan ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") domain scan of "
+               << simdPoints.size() << " points" << endl;
+
+  std::set<Space::Point> ordered( points.begin(), points.end() );
+  std::set<SIMDSpace::Point> simdOrdered( simdPoints.begin(), simdPoints.end() );
+  nbok += ( ordered.size() == simdOrdered.size()
+            && std::equal( ordered.begin(), ordered.end(), simdOrdered.begin(),
+                           same<Space::Point, SIMDSpace::Point> ) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") ordered set" << endl;
+
+  typedef MetricAdjacency<Space, 2> Adjacency;
+  typedef MetricAdjacency<SIMDSpace, 2> SIMDAdjacency;
+  std::vector<Space::Point> neighbors;
+  std::vector<SIMDSpace::Point> simdNeighbors;
+  std::back_insert_iterator< std::vector<Space::Point> > it( neighbors );
+  std::back_insert_iterator< std::vector<SIMDSpace::Point> > simdIt( simdNeighbors );
+  Adjacency::writeNeighbors( it, Space::Point( 1, -7, 3 ) );
+  SIMDAdjacency::writeNeighbors( simdIt, SIMDSpace::Point( 1, -7, 3 ) );
+  bool sameNeighbors = neighbors.size() == 18 && neighbors.size() == simdNeighbors.size();
+  for ( std::size_t i = 0; sameNeighbors && i < neighbors.size(); ++i )
+    sameNeighbors = same( simdNeighbors[ i ], neighbors[ i ] );
+  nbok += sameNeighbors ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") 18-neighborhood" << endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class SIMDArray" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testOperations<DGtal::int32_t, 1>( "1 x int32" )
+    && testOperations<DGtal::int32_t, 2>( "2 x int32" )
+    && testOperations<DGtal::int32_t, 3>( "3 x int32" )
+    && testOperations<DGtal::int32_t, 4>( "4 x int32" )
+    && testOperations<DGtal::int64_t, 1>( "1 x int64" )
+    && testOperations<DGtal::int64_t, 2>( "2 x int64" )
+    && testOperations<DGtal::int64_t, 3>( "3 x int64" )
+    && testOperations<DGtal::int64_t, 4>( "4 x int64" )
+    && testOperations<double, 3>( "3 x double" )
+    && testSpace();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////